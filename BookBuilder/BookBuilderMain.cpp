@@ -0,0 +1,248 @@
+// Generador del libro de aperturas a partir de partidas de auto-juego.
+// Lee las partidas grabadas con SelfPlay --record (una por linea: el resultado y los turnos), las repite
+// sobre un GameEngine para validar cada jugada y, en los primeros turnos de cada partida, acumula por
+// posicion y movimiento cuantas partidas lo jugaron y cuantas gano o empato el bando que lo jugo.
+// Las entradas se escriben ordenadas por clave y movimiento (ver OpeningBook), y al terminar se mide
+// el tiempo de consulta del libro generado.
+//
+// Uso:
+//   BookBuilder --input archivo [--input archivo ...] [--turns N] [--min-games M] [--output archivo]
+//     --input      Partidas grabadas con SelfPlay --record (se puede repetir)
+//     --turns      Turnos desde la posicion inicial que cubre el libro (por defecto 16)
+//     --min-games  Partidas minimas para guardar un movimiento (por defecto 2)
+//     --output     Archivo del libro (por defecto damas_book.bin)
+
+#include "Board.h"              // Para Board::ToSquareIndex
+#include "CommonTypes.h"        // Para PlayerColor
+#include "GameEngine.h"         // Para repetir las partidas con las reglas del juego
+#include "MoveSequence.h"       // Para MoveSequence y MoveSequenceList
+#include "OpeningBook.h"        // Para el formato del archivo, el codigo de los movimientos y la medicion de las consultas
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	struct BuilderOptions {
+		std::vector<std::string> inputPaths;
+		int turns = 16;
+		int minGames = 2;
+		std::string outputPath = OpeningBook::DEFAULT_FILENAME;
+	};
+
+	// Estadisticas acumuladas por (clave de la posicion, codigo del movimiento); el mapa ya queda en el
+	// orden del archivo
+	using BookStatistics = std::map<std::pair<std::uint64_t, std::uint64_t>, BookMoveStats>;
+
+	bool ParseOptions(int argc, char* argv[], BuilderOptions& options) {
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			if (i + 1 >= argc) return false;
+			std::string value = argv[++i];
+			if (arg == "--input") options.inputPaths.push_back(value);
+			else if (arg == "--turns") options.turns = std::atoi(value.c_str());
+			else if (arg == "--min-games") options.minGames = std::atoi(value.c_str());
+			else if (arg == "--output") options.outputPath = value;
+			else return false;
+		}
+		return !options.inputPaths.empty() && options.turns > 0 && options.minGames > 0;
+	}
+
+	// Casillas de un turno escrito como "C3-D4" o "C3xE5xG7" (la de salida y las de aterrizaje)
+	bool ParseTurn(const std::string& turn, std::vector<int>& outSquares) {
+		outSquares.clear();
+		for (std::size_t i = 0; i < turn.size(); i += 3) {
+			if (i + 2 > turn.size() || (i > 0 && turn[i - 1] != '-' && turn[i - 1] != 'x')) {
+				return false;
+			}
+			int col = turn[i] - 'A';
+			int row = '8' - turn[i + 1];
+			if (col < 0 || col > 7 || row < 0 || row > 7 || (row + col) % 2 == 0) {
+				return false;
+			}
+			outSquares.push_back(Board::ToSquareIndex(row, col));
+		}
+		return outSquares.size() >= 2 && turn.size() == 3 * outSquares.size() - 1;
+	}
+
+	// Movimiento completo legal que recorre exactamente esas casillas (nullptr si no hay ninguno)
+	const MoveSequence* FindSequence(const MoveSequenceList& legalMoves, const std::vector<int>& squares) {
+		for (int i = 0; i < legalMoves.size(); ++i) {
+			const MoveSequence& move = legalMoves[i];
+			if (move.startSquare_ != squares[0] || move.numSteps_ != static_cast<int>(squares.size()) - 1) {
+				continue;
+			}
+			bool matches = true;
+			for (int step = 0; step < move.numSteps_ && matches; ++step) {
+				matches = (move.landingSquares_[step] == squares[step + 1]);
+			}
+			if (matches) {
+				return &move;
+			}
+		}
+		return nullptr;
+	}
+
+	// Repite una partida y suma sus primeros turnos a las estadisticas. Devuelve false si la linea no
+	// es valida o tiene una jugada ilegal (la partida se descarta entera).
+	bool AddGame(const std::string& line, int turns, GameEngine& engine, BookStatistics& statistics) {
+		std::istringstream input(line);
+		std::string result;
+		input >> result;
+		PlayerColor winner = PlayerColor::NONE;
+		if (result == "1-0") winner = PlayerColor::PLAYER_1;
+		else if (result == "0-1") winner = PlayerColor::PLAYER_2;
+		else if (result != "1/2") return false;
+
+		// Se valida toda la parte que entra en el libro antes de sumar nada
+		engine.NewGame();
+		std::vector<std::pair<std::uint64_t, std::uint64_t>> played;
+		std::vector<PlayerColor> movers;
+		std::vector<int> squares;
+		MoveSequenceList legalMoves;
+		std::string turn;
+		while (static_cast<int>(played.size()) < turns && !engine.IsOver() && input >> turn) {
+			if (!ParseTurn(turn, squares)) {
+				return false;
+			}
+			engine.LegalMoveSequences(legalMoves);
+			const MoveSequence* move = FindSequence(legalMoves, squares);
+			if (move == nullptr) {
+				return false;
+			}
+			played.emplace_back(engine.GetBoard().GetHashKey(), OpeningBook::EncodeMove(*move));
+			movers.push_back(engine.GetCurrentPlayer());
+			if (engine.ApplySequence(*move) != MoveResult::APPLIED) {
+				return false;
+			}
+		}
+
+		for (std::size_t i = 0; i < played.size(); ++i) {
+			BookMoveStats& stats = statistics[played[i]];
+			stats.move = played[i].second;
+			++stats.games;
+			if (winner == movers[i]) ++stats.wins;
+			else if (winner == PlayerColor::NONE) ++stats.draws;
+		}
+		return true;
+	}
+
+	void WriteUint32(std::ofstream& output, std::uint32_t value) {
+		char bytes[4];
+		for (int i = 0; i < 4; ++i) bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+		output.write(bytes, 4);
+	}
+
+	void WriteUint64(std::ofstream& output, std::uint64_t value) {
+		WriteUint32(output, static_cast<std::uint32_t>(value));
+		WriteUint32(output, static_cast<std::uint32_t>(value >> 32));
+	}
+
+	// Escribe las entradas con al menos 'minGames' partidas; devuelve cuantas se escribieron (-1 si falla)
+	long long WriteBook(const BookStatistics& statistics, const BuilderOptions& options) {
+		std::uint32_t entryCount = 0;
+		for (const auto& entry : statistics) {
+			if (entry.second.games >= static_cast<std::uint32_t>(options.minGames)) ++entryCount;
+		}
+		std::ofstream output(options.outputPath, std::ios::binary);
+		if (!output) {
+			return -1;
+		}
+		output.write(OpeningBook::FILE_MAGIC, 8);
+		WriteUint32(output, entryCount);
+		WriteUint32(output, static_cast<std::uint32_t>(options.turns));
+		for (const auto& entry : statistics) {
+			const BookMoveStats& stats = entry.second;
+			if (stats.games < static_cast<std::uint32_t>(options.minGames)) {
+				continue;
+			}
+			WriteUint64(output, entry.first.first);
+			WriteUint64(output, stats.move);
+			WriteUint32(output, stats.games);
+			WriteUint32(output, stats.wins);
+			WriteUint32(output, stats.draws);
+		}
+		return output ? static_cast<long long>(entryCount) : -1;
+	}
+
+	// Carga el libro escrito y mide el tiempo medio de consulta de sus posiciones y de posiciones ausentes
+	void MeasureLookups(const BuilderOptions& options, const BookStatistics& statistics) {
+		OpeningBook book;
+		std::chrono::steady_clock::time_point loadStart = std::chrono::steady_clock::now();
+		if (!book.Load(options.outputPath)) {
+			std::cerr << "No se pudo cargar el libro generado" << std::endl;
+			return;
+		}
+		double loadMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - loadStart).count();
+
+		std::vector<std::uint64_t> keys;
+		for (const auto& entry : statistics) {
+			if (keys.empty() || keys.back() != entry.first.first) {
+				keys.push_back(entry.first.first);
+				keys.push_back(entry.first.first ^ 0x9E3779B97F4A7C15ull); // Posicion que no esta en el libro
+			}
+		}
+		BookMoveStats moves[32];
+		long long found = 0;
+		const int repetitions = 20;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int repetition = 0; repetition < repetitions; ++repetition) {
+			for (std::uint64_t key : keys) {
+				found += book.Lookup(key, moves, 32);
+			}
+		}
+		double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "Carga del libro: " << loadMicroseconds << " us  Consulta media: "
+			<< (keys.empty() ? 0.0 : microseconds / (static_cast<double>(keys.size()) * repetitions)) << " us"
+			<< "  (control " << found << ")" << std::endl;
+	}
+}
+
+// Funcion principal
+int main(int argc, char* argv[]) {
+	BuilderOptions options;
+	if (!ParseOptions(argc, argv, options)) {
+		std::cerr << "Uso: BookBuilder --input archivo [--input archivo ...] [--turns N] [--min-games M] [--output archivo]" << std::endl;
+		return 1;
+	}
+
+	GameEngine engine;
+	BookStatistics statistics;
+	long long gamesUsed = 0, gamesRejected = 0;
+	for (const std::string& path : options.inputPaths) {
+		std::ifstream input(path);
+		if (!input.is_open()) {
+			std::cerr << "No se pudo abrir el archivo de partidas: " << path << std::endl;
+			return 1;
+		}
+		std::string line;
+		while (std::getline(input, line)) {
+			if (line.empty()) continue;
+			if (AddGame(line, options.turns, engine, statistics)) ++gamesUsed;
+			else ++gamesRejected;
+		}
+	}
+	if (gamesUsed == 0) {
+		std::cerr << "No hay partidas validas en los archivos de entrada" << std::endl;
+		return 1;
+	}
+
+	long long entriesWritten = WriteBook(statistics, options);
+	if (entriesWritten < 0) {
+		std::cerr << "No se pudo escribir " << options.outputPath << std::endl;
+		return 1;
+	}
+	std::cout << "Partidas: " << gamesUsed << " (descartadas: " << gamesRejected << ")  Turnos: " << options.turns << std::endl;
+	std::cout << "Movimientos distintos: " << statistics.size() << "  Guardados (" << options.minGames
+		<< "+ partidas): " << entriesWritten << std::endl;
+	std::cout << "Libro guardado en " << options.outputPath << std::endl;
+	MeasureLookups(options, statistics);
+	return 0;
+}
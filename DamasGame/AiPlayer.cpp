@@ -0,0 +1,92 @@
+#include "AiPlayer.h"
+#include "CommonTypes.h"
+#include "Board.h"
+
+#include <chrono>
+#include <thread>
+
+// Constructor de AiPlayer
+AiPlayer::AiPlayer(PlayerColor color)
+	: Player(color),
+	m_thinkingDelayEnabled(true),
+	m_searchThreads(1),
+	m_timeManager(),
+	m_plannedSequence(),
+	m_plannedStep(0) {
+	// Sembrar el generador de numeros aleatorios con la hora actual
+	m_rng.seed(static_cast<unsigned>(std::chrono::system_clock::now().time_since_epoch().count()));
+}
+
+MoveInput AiPlayer::GetChosenMoveInput(
+	const Board& board,
+	const MoveGenerator& moveGenerator,
+	bool isInCaptureSequence,
+	int forcedRow,
+	int forcedCol
+) {
+	MoveSequenceList legalMoves;
+	if (isInCaptureSequence) {
+		moveGenerator.GenerateCaptureSequencesForPiece(board, forcedRow, forcedCol, legalMoves);
+	}
+	else {
+		moveGenerator.GenerateMoveSequences(board, m_color, legalMoves);
+	}
+	return GetChosenMoveInput(board, moveGenerator, isInCaptureSequence, forcedRow, forcedCol, legalMoves);
+}
+
+// GameManager juega las cadenas salto a salto: el primer salto se devuelve ahora y los siguientes se
+// devuelven desde la secuencia planificada en las llamadas de continuacion.
+MoveInput AiPlayer::GetChosenMoveInput(
+	const Board& board,
+	const MoveGenerator& /*moveGenerator*/, // Parametro de la interfaz: los candidatos ya vienen en legalMoves
+	bool isInCaptureSequence,
+	int forcedRow,
+	int forcedCol,
+	const MoveSequenceList& legalMoves
+) {
+	std::chrono::steady_clock::time_point decisionStart = std::chrono::steady_clock::now();
+	MoveInput chosenAiMove;
+	chosenAiMove.isValidFormat = false; // Por defecto, si no se encuentra nada
+	chosenAiMove.wantsToExit = false;
+	chosenAiMove.wantsToShowStats = false;
+
+	// Continuacion de la cadena planificada: la pieza obligada esta donde termino el salto anterior
+	if (isInCaptureSequence && m_plannedStep > 0 && m_plannedStep < m_plannedSequence.numSteps_ &&
+		m_plannedSequence.landingSquares_[m_plannedStep - 1] == Board::ToSquareIndex(forcedRow, forcedCol)) {
+		Move nextStep = m_plannedSequence.GetStep(m_plannedStep++);
+		chosenAiMove.startRow = nextStep.startR_;
+		chosenAiMove.startCol = nextStep.startC_;
+		chosenAiMove.endRow = nextStep.endR_;
+		chosenAiMove.endCol = nextStep.endC_;
+		chosenAiMove.isValidFormat = true;
+		return chosenAiMove;
+	}
+
+	if (legalMoves.empty()) {
+		// No hay movimientos validos (la IA esta bloqueada o es un error si HasAnyValidMoves dijo que si habia)
+		m_plannedStep = 0;
+		return chosenAiMove; // Devuelve isValidFormat = false
+	}
+
+	// Se juega el primer salto y se guarda el resto de la cadena para las llamadas siguientes
+	m_plannedSequence = ChooseSequence(board, isInCaptureSequence, legalMoves);
+	m_plannedStep = 1;
+	Move firstStep = m_plannedSequence.GetStep(0);
+	chosenAiMove.startRow = firstStep.startR_;
+	chosenAiMove.startCol = firstStep.startC_;
+	chosenAiMove.endRow = firstStep.endR_;
+	chosenAiMove.endCol = firstStep.endC_;
+	chosenAiMove.isValidFormat = true;
+
+	if (m_timeManager.IsActive()) {
+		m_timeManager.MoveFinished(std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now() - decisionStart).count());
+	}
+	// Simula un pequeno retraso para que la IA no sea instantanea (solo estetico; con reloj no se hace)
+	else if (m_thinkingDelayEnabled) {
+		std::uniform_int_distribution<int> delay_dist(200, 800); // Milisegundos
+		std::this_thread::sleep_for(std::chrono::milliseconds(delay_dist(m_rng)));
+	}
+
+	return chosenAiMove;
+}
@@ -0,0 +1,77 @@
+#ifndef AI_PLAYER_H
+#define AI_PLAYER_H
+
+#include "Player.h"
+#include "MoveSequence.h"  // Para MoveSequence (cadenas de captura completas)
+#include "TimeManager.h"   // Para el control de tiempo por jugada o por partida
+#include <random>          // Para std::mt19937
+
+// Clase base de los jugadores controlados por la computadora (ComputerPlayer y MctsComputerPlayer).
+// La IA elige movimientos completos, pero GameManager los pide salto a salto: esta clase devuelve el primer
+// salto del movimiento elegido y los siguientes desde la secuencia planificada en las llamadas de
+// continuacion. Tambien lleva el reloj de la IA y la pausa estetica antes de cada jugada.
+// Cada motor solo implementa ChooseSequence.
+class AiPlayer : public Player {
+public:
+	// Constructor de AiPlayer
+	// color: color asignado al jugador (blanco o negro)
+	// Siembra el generador aleatorio con la hora actual
+	AiPlayer(PlayerColor color);
+
+	// Activa o desactiva la pausa de 200-800 ms antes de cada jugada (solo estetica, activa por defecto).
+	// Las partidas sin interfaz (auto-juego) la desactivan. Con control de tiempo nunca se hace la pausa.
+	void SetThinkingDelayEnabled(bool enabled) { m_thinkingDelayEnabled = enabled; }
+
+	// Hilos de la busqueda. Con 1 (por defecto) la busqueda corre en el hilo llamador.
+	void SetSearchThreads(int threads) { m_searchThreads = (threads < 1) ? 1 : threads; }
+
+	// Fija la semilla de los generadores aleatorios (para partidas reproducibles)
+	virtual void SetRandomSeed(unsigned seed) { m_rng.seed(seed); }
+
+	// Fija el control de tiempo y pone el reloj a cero; se llama al empezar cada partida.
+	// Con control de tiempo la IA piensa lo que le asigna el reloj y no lo que marca la dificultad.
+	void SetTimeControl(const TimeControl& timeControl) { m_timeManager.SetTimeControl(timeControl); }
+	const TimeManager& GetTimeManager() const { return m_timeManager; }
+
+	// Devuelve el siguiente salto de la cadena planificada o, al empezar el turno, el primer salto del
+	// movimiento que elige ChooseSequence entre 'legalMoves' (los movimientos completos legales del turno,
+	// los de la cache de GameEngine). Devuelve un MoveInput invalido si no hay movimientos posibles.
+	MoveInput GetChosenMoveInput(
+		const Board& board,
+		const MoveGenerator& moveGenerator,
+		bool isInCaptureSequence,
+		int forcedRow,
+		int forcedCol,
+		const MoveSequenceList& legalMoves
+	);
+
+	// Interfaz de Player, para quien no tiene la cache de GameEngine: genera los candidatos con
+	// moveGenerator (las continuaciones de la pieza obligada si hay una cadena en curso)
+	MoveInput GetChosenMoveInput(
+		const Board& board,
+		const MoveGenerator& moveGenerator,
+		bool isInCaptureSequence,
+		int forcedRow,
+		int forcedCol
+	) override final;
+
+protected:
+	// Elige uno de los movimientos completos de 'legalMoves' (nunca vacia).
+	// isInCaptureSequence: la cadena en curso no es la planificada y legalMoves solo tiene sus continuaciones
+	virtual MoveSequence ChooseSequence(const Board& board, bool isInCaptureSequence, const MoveSequenceList& legalMoves) = 0;
+
+	std::mt19937 m_rng; // Generador aleatorio para desempates, variedad y la pausa estetica
+
+	bool m_thinkingDelayEnabled; // Indica si se simula una pausa antes de cada jugada
+	int m_searchThreads;         // Hilos usados por la busqueda
+
+	// Reloj de la IA (inactivo por defecto: el esfuerzo depende solo de la dificultad)
+	TimeManager m_timeManager;
+
+private:
+	// Movimiento completo elegido en el turno actual; los saltos restantes se devuelven desde aqui
+	MoveSequence m_plannedSequence;
+	int m_plannedStep; // Indice del siguiente salto de m_plannedSequence a devolver
+};
+
+#endif // AI_PLAYER_H
@@ -0,0 +1,142 @@
+// Utilidades de bitboard para el tablero de Damas
+// Cada una de las 32 casillas jugables (oscuras) se representa con un bit de un entero de 32 bits.
+// El indice de casilla es fila * 4 + columna / 2, de modo que el bit 0 es la casilla B8 (fila 0)
+// y el bit 31 es la casilla G1 (fila 7).
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h> // Para __popcnt y _BitScanForward
+#endif
+
+// Mascara de 32 bits, un bit por casilla jugable
+using Bitboard = std::uint32_t;
+
+// Mascara con todas las casillas jugables
+constexpr Bitboard BITBOARD_ALL_SQUARES = 0xFFFFFFFFu;
+
+// Mascaras de filas y bordes usadas por los desplazamientos diagonales
+constexpr Bitboard BITBOARD_EVEN_ROWS = 0x0F0F0F0Fu;  // Filas 0, 2, 4, 6 (casillas en columnas impares)
+constexpr Bitboard BITBOARD_ODD_ROWS = 0xF0F0F0F0u;   // Filas 1, 3, 5, 7 (casillas en columnas pares)
+constexpr Bitboard BITBOARD_ROW_0 = 0x0000000Fu;      // Fila superior (coronacion de P1)
+constexpr Bitboard BITBOARD_ROW_7 = 0xF0000000u;      // Fila inferior (coronacion de P2)
+constexpr Bitboard BITBOARD_LEFT_EDGE = 0x10101010u;  // Columna 0
+constexpr Bitboard BITBOARD_RIGHT_EDGE = 0x08080808u; // Columna 7
+
+// Direcciones diagonales, con la fila 0 en la parte superior del tablero
+enum class Direction {
+	UP_LEFT,    // (fila - 1, columna - 1)
+	UP_RIGHT,   // (fila - 1, columna + 1)
+	DOWN_LEFT,  // (fila + 1, columna - 1)
+	DOWN_RIGHT  // (fila + 1, columna + 1)
+};
+
+// Devuelve la direccion opuesta (la que deshace un paso en 'dir')
+constexpr Direction OppositeDirection(Direction dir) {
+	switch (dir) {
+	case Direction::UP_LEFT: return Direction::DOWN_RIGHT;
+	case Direction::UP_RIGHT: return Direction::DOWN_LEFT;
+	case Direction::DOWN_LEFT: return Direction::UP_RIGHT;
+	default: return Direction::UP_LEFT;
+	}
+}
+
+// Desplaza todas las casillas de la mascara un paso diagonal en la direccion indicada.
+// Las casillas cuyo destino cae fuera del tablero desaparecen del resultado.
+// El desplazamiento depende de la paridad de la fila porque las casillas oscuras alternan de columna.
+constexpr Bitboard ShiftBitboard(Bitboard bb, Direction dir) {
+	switch (dir) {
+	case Direction::UP_LEFT:
+		return ((bb & BITBOARD_EVEN_ROWS & ~BITBOARD_ROW_0) >> 4) | ((bb & BITBOARD_ODD_ROWS & ~BITBOARD_LEFT_EDGE) >> 5);
+	case Direction::UP_RIGHT:
+		return ((bb & BITBOARD_EVEN_ROWS & ~BITBOARD_ROW_0 & ~BITBOARD_RIGHT_EDGE) >> 3) | ((bb & BITBOARD_ODD_ROWS) >> 4);
+	case Direction::DOWN_LEFT:
+		return ((bb & BITBOARD_EVEN_ROWS) << 4) | ((bb & BITBOARD_ODD_ROWS & ~BITBOARD_ROW_7 & ~BITBOARD_LEFT_EDGE) << 3);
+	default: // Direction::DOWN_RIGHT
+		return ((bb & BITBOARD_EVEN_ROWS & ~BITBOARD_RIGHT_EDGE) << 5) | ((bb & BITBOARD_ODD_ROWS & ~BITBOARD_ROW_7) << 4);
+	}
+}
+
+// Devuelve la mascara con un unico bit encendido para la casilla indicada
+constexpr Bitboard SquareBit(int square) {
+	return static_cast<Bitboard>(1u) << square;
+}
+
+// --- Tablas de vecinos por casilla ---
+// Casilla inexistente en las tablas de vecinos: el paso en esa direccion sale del tablero
+constexpr int NO_SQUARE = -1;
+
+// Casilla vecina y casilla de aterrizaje de un salto para cada casilla jugable y cada direccion,
+// indexadas por [casilla][Direction]. Guardan NO_SQUARE cuando la casilla cae fuera del tablero.
+struct SquareTables {
+	std::int8_t neighbor[32][4];
+	std::int8_t jump[32][4];
+};
+
+// Genera las tablas en tiempo de compilacion a partir de ShiftBitboard, asi que siguen las mismas
+// reglas de bordes y paridad de fila que los desplazamientos de mascaras
+constexpr SquareTables BuildSquareTables() {
+	SquareTables tables = {};
+	for (int square = 0; square < 32; ++square) {
+		for (int dir = 0; dir < 4; ++dir) {
+			Bitboard neighborBit = ShiftBitboard(SquareBit(square), static_cast<Direction>(dir));
+			Bitboard jumpBit = ShiftBitboard(neighborBit, static_cast<Direction>(dir));
+			tables.neighbor[square][dir] = NO_SQUARE;
+			tables.jump[square][dir] = NO_SQUARE;
+			for (int target = 0; target < 32; ++target) {
+				if (neighborBit == SquareBit(target)) tables.neighbor[square][dir] = static_cast<std::int8_t>(target);
+				if (jumpBit == SquareBit(target)) tables.jump[square][dir] = static_cast<std::int8_t>(target);
+			}
+		}
+	}
+	return tables;
+}
+
+constexpr SquareTables SQUARE_TABLES = BuildSquareTables();
+
+// Casilla vecina de 'square' en la direccion indicada (NO_SQUARE si sale del tablero)
+constexpr int NeighborSquare(int square, Direction dir) {
+	return SQUARE_TABLES.neighbor[square][static_cast<int>(dir)];
+}
+
+// Casilla donde aterriza un salto desde 'square' en la direccion indicada (NO_SQUARE si sale del tablero).
+// La pieza saltada es la de NeighborSquare(square, dir).
+constexpr int JumpSquare(int square, Direction dir) {
+	return SQUARE_TABLES.jump[square][static_cast<int>(dir)];
+}
+
+static_assert(NeighborSquare(0, Direction::DOWN_LEFT) == 4 && NeighborSquare(0, Direction::UP_LEFT) == NO_SQUARE,
+	"Tabla de vecinos incorrecta");
+static_assert(JumpSquare(0, Direction::DOWN_RIGHT) == 9 && JumpSquare(3, Direction::DOWN_RIGHT) == NO_SQUARE,
+	"Tabla de saltos incorrecta");
+
+// Cuenta la cantidad de bits encendidos (piezas) en la mascara
+inline int PopCount(Bitboard bb) {
+#ifdef _MSC_VER
+	return static_cast<int>(__popcnt(bb));
+#else
+	return __builtin_popcount(bb);
+#endif
+}
+
+// Devuelve el indice del bit encendido mas bajo. La mascara no debe ser cero.
+inline int LowestBitIndex(Bitboard bb) {
+#ifdef _MSC_VER
+	unsigned long index = 0;
+	_BitScanForward(&index, bb);
+	return static_cast<int>(index);
+#else
+	return __builtin_ctz(bb);
+#endif
+}
+
+// Extrae y apaga el bit encendido mas bajo, devolviendo su indice. La mascara no debe ser cero.
+inline int PopLowestBit(Bitboard& bb) {
+	int index = LowestBitIndex(bb);
+	bb &= bb - 1;
+	return index;
+}
+
+#endif // BITBOARD_H
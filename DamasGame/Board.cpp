@@ -1,12 +1,57 @@
 #include "Board.h"       
 #include "CommonTypes.h" // Para PieceType, PlayerColor
+#include "CompactMove.h" // Para MakeMove con movimientos empaquetados
+#include "Evaluator.h"   // Para las tablas de pieza-casilla de la evaluacion incremental
 
-#include <stdexcept>     // Para std::out_of_range
+#include <stdexcept>     // Para std::out_of_range, std::invalid_argument
 #include <iostream>      // Para std::cout 
 
+namespace {
+	// Tabla de claves Zobrist: un numero aleatorio de 64 bits por (tipo de pieza, casilla) y uno para el turno.
+	// Se genera en tiempo de compilacion con splitmix64 a partir de una semilla fija,
+	// de modo que las claves son identicas en cada ejecucion (y en archivos guardados).
+	struct ZobristTable {
+		std::uint64_t pieceKeys[4][Board::NUM_PLAYABLE_SQUARES]; // Indexado por PieceType (sin EMPTY)
+		std::uint64_t sideToMoveKey;                              // Se aplica cuando mueve PLAYER_2
+	};
+
+	constexpr std::uint64_t SplitMix64(std::uint64_t& state) {
+		std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	constexpr ZobristTable BuildZobristTable() {
+		ZobristTable table{};
+		std::uint64_t state = 0x44616D6173ull; // Semilla fija
+		for (int piece = 0; piece < 4; ++piece) {
+			for (int square = 0; square < Board::NUM_PLAYABLE_SQUARES; ++square) {
+				table.pieceKeys[piece][square] = SplitMix64(state);
+			}
+		}
+		table.sideToMoveKey = SplitMix64(state);
+		return table;
+	}
+
+	constexpr ZobristTable ZOBRIST_KEYS = BuildZobristTable();
+
+	// Clave de una pieza en una casilla (las casillas vacias no aportan a la clave)
+	inline std::uint64_t PieceKey(PieceType piece, int square) {
+		return (piece == PieceType::EMPTY) ? 0 : ZOBRIST_KEYS.pieceKeys[static_cast<int>(piece)][square];
+	}
+
+	// Indice del dueno de una pieza en los acumuladores (0 = PLAYER_1, 1 = PLAYER_2)
+	inline int PieceOwnerIndex(PieceType piece) {
+		return (piece == PieceType::P1_MAN || piece == PieceType::P1_KING) ? 0 : 1;
+	}
+}
+
 // --- Implementacion del Constructor ---
 // Inicializa el tablero vacio y resetea los contadores de piezas
-Board::Board() {
+Board::Board()
+	: mHashKey(0),
+	mSideToMove(PlayerColor::PLAYER_1) {
 	ClearBoard();
 	ResetPieceCounts();
 }
@@ -17,6 +62,8 @@ Board::Board() {
 void Board::InitializeBoard() {
 	ClearBoard();
 	ResetPieceCounts();
+	mHashKey = 0;
+	mSideToMove = PlayerColor::PLAYER_1; // Siempre empiezan las Blancas
 
 	// P1 (Blancas) empiezan abajo (filas de indice alto: 5, 6, 7 si 0 es arriba)
 	// P2 (Negras) empiezan arriba (filas de indice bajo: 0, 1, 2 si 0 es arriba)
@@ -34,12 +81,13 @@ void Board::InitializeBoard() {
 	}
 }
 
-// Devuelve el tipo de pieza en la posicion indicada, o EMPTY si esta fuera de rango
+// Devuelve el tipo de pieza en la posicion indicada, o EMPTY si esta fuera de rango o no es jugable
 PieceType Board::GetPieceAt(int row, int col) const {
-	if (!IsWithinBounds(row, col)) {
+	int square = ToSquareIndex(row, col);
+	if (square < 0) {
 		return PieceType::EMPTY;
 	}
-	return mGrid[row][col];
+	return GetPieceAtSquare(square);
 }
 
 // Coloca una pieza en la posicion indicada y actualiza los contadores
@@ -47,9 +95,46 @@ void Board::SetPieceAt(int row, int col, PieceType pieceType) {
 	if (!IsWithinBounds(row, col)) {
 		throw std::out_of_range("Board::SetPieceAt: Coordenadas fuera de rango.");
 	}
-	PieceType oldPiece = mGrid[row][col];
-	mGrid[row][col] = pieceType;
-	UpdateCountsForSetPiece(row, col, oldPiece, pieceType);
+	int square = ToSquareIndex(row, col);
+	if (square < 0) {
+		// Las casillas claras siempre estan vacias; solo se rechaza colocar una pieza en ellas
+		if (pieceType != PieceType::EMPTY) {
+			throw std::invalid_argument("Board::SetPieceAt: La casilla no es jugable.");
+		}
+		return;
+	}
+	SetPieceAtSquare(square, pieceType);
+}
+
+// Devuelve el tipo de pieza en una casilla jugable consultando las mascaras
+PieceType Board::GetPieceAtSquare(int square) const {
+	Bitboard bit = SquareBit(square);
+	if (mEmptySquares & bit) return PieceType::EMPTY;
+	if (mPieceBitboards[static_cast<int>(PieceType::P1_MAN)] & bit) return PieceType::P1_MAN;
+	if (mPieceBitboards[static_cast<int>(PieceType::P1_KING)] & bit) return PieceType::P1_KING;
+	if (mPieceBitboards[static_cast<int>(PieceType::P2_MAN)] & bit) return PieceType::P2_MAN;
+	return PieceType::P2_KING;
+}
+
+// Coloca una pieza en una casilla jugable, actualizando las mascaras y los contadores
+void Board::SetPieceAtSquare(int square, PieceType pieceType) {
+	PieceType oldPiece = GetPieceAtSquare(square);
+	if (oldPiece == pieceType) {
+		return;
+	}
+	Bitboard bit = SquareBit(square);
+	if (oldPiece == PieceType::EMPTY) mEmptySquares &= ~bit;
+	else mPieceBitboards[static_cast<int>(oldPiece)] &= ~bit;
+
+	if (pieceType == PieceType::EMPTY) mEmptySquares |= bit;
+	else mPieceBitboards[static_cast<int>(pieceType)] |= bit;
+
+	mHashKey ^= PieceKey(oldPiece, square) ^ PieceKey(pieceType, square);
+
+	if (oldPiece != PieceType::EMPTY) mEvaluationAccumulators[PieceOwnerIndex(oldPiece)] -= PieceSquareValue(oldPiece, square);
+	if (pieceType != PieceType::EMPTY) mEvaluationAccumulators[PieceOwnerIndex(pieceType)] += PieceSquareValue(pieceType, square);
+
+	UpdateCountsForSetPiece(oldPiece, pieceType);
 }
 
 // Verifica si la posicion esta dentro de los limites del tablero
@@ -67,6 +152,25 @@ bool Board::IsPlayableSquare(int row, int col) const {
 	return (row % 2) != (col % 2);
 }
 
+// Devuelve la mascara de un tipo de pieza; EMPTY devuelve la mascara de casillas vacias
+Bitboard Board::GetPieceBitboard(PieceType pieceType) const {
+	if (pieceType == PieceType::EMPTY) {
+		return mEmptySquares;
+	}
+	return mPieceBitboards[static_cast<int>(pieceType)];
+}
+
+// Devuelve la union de las mascaras de peones y damas de un jugador
+Bitboard Board::GetPlayerBitboard(PlayerColor player) const {
+	if (player == PlayerColor::PLAYER_1) {
+		return mPieceBitboards[static_cast<int>(PieceType::P1_MAN)] | mPieceBitboards[static_cast<int>(PieceType::P1_KING)];
+	}
+	if (player == PlayerColor::PLAYER_2) {
+		return mPieceBitboards[static_cast<int>(PieceType::P2_MAN)] | mPieceBitboards[static_cast<int>(PieceType::P2_KING)];
+	}
+	return 0;
+}
+
 // Devuelve la cantidad total de piezas (peones + damas) de un jugador
 int Board::GetPieceCount(PlayerColor player) const {
 	int playerIndex = (player == PlayerColor::PLAYER_1) ? 0 : ((player == PlayerColor::PLAYER_2) ? 1 : -1);
@@ -81,6 +185,51 @@ int Board::GetKingCount(PlayerColor player) const {
 	return mPieceCounts[playerIndex][1];
 }
 
+// Devuelve el acumulador de evaluacion de un jugador
+int Board::GetEvaluationAccumulator(PlayerColor player) const {
+	if (player == PlayerColor::PLAYER_1) return mEvaluationAccumulators[0];
+	if (player == PlayerColor::PLAYER_2) return mEvaluationAccumulators[1];
+	return 0;
+}
+
+// Recalcula el acumulador de evaluacion de un jugador sumando la tabla de pieza-casilla de cada pieza
+int Board::ComputeEvaluationAccumulator(PlayerColor player) const {
+	if (player == PlayerColor::NONE) return 0;
+	PieceType man = (player == PlayerColor::PLAYER_1) ? PieceType::P1_MAN : PieceType::P2_MAN;
+	PieceType king = (player == PlayerColor::PLAYER_1) ? PieceType::P1_KING : PieceType::P2_KING;
+	int total = 0;
+	for (PieceType piece : { man, king }) {
+		Bitboard pieces = mPieceBitboards[static_cast<int>(piece)];
+		while (pieces) {
+			total += PieceSquareValue(piece, PopLowestBit(pieces));
+		}
+	}
+	return total;
+}
+
+// Recalcula la clave Zobrist desde cero a partir de las mascaras y el turno
+std::uint64_t Board::ComputeHashKey() const {
+	std::uint64_t key = 0;
+	for (int piece = 0; piece < 4; ++piece) {
+		Bitboard pieces = mPieceBitboards[piece];
+		while (pieces) {
+			key ^= PieceKey(static_cast<PieceType>(piece), PopLowestBit(pieces));
+		}
+	}
+	if (mSideToMove == PlayerColor::PLAYER_2) {
+		key ^= ZOBRIST_KEYS.sideToMoveKey;
+	}
+	return key;
+}
+
+// Cambia el bando al que le toca mover; la clave incluye el turno solo cuando mueve PLAYER_2
+void Board::SetSideToMove(PlayerColor player) {
+	if ((mSideToMove == PlayerColor::PLAYER_2) != (player == PlayerColor::PLAYER_2)) {
+		mHashKey ^= ZOBRIST_KEYS.sideToMoveKey;
+	}
+	mSideToMove = player;
+}
+
 // Promueve una pieza a dama si llega a la fila de coronacion
 void Board::PromotePieceIfNecessary(int row, int col) {
 	if (!IsWithinBounds(row, col)) {
@@ -98,27 +247,114 @@ void Board::PromotePieceIfNecessary(int row, int col) {
 	}
 }
 
+// Aplica un movimiento elemental. Es el unico camino de mutacion que comparten el bucle de juego y la busqueda.
+MoveUndo Board::MakeMove(const Move& move) {
+	return MakeMove(CompactMove::FromMove(move));
+}
+
+MoveUndo Board::MakeMove(CompactMove move) {
+	MoveUndo undo;
+	int from = move.GetFromSquare();
+	int to = move.GetToSquare();
+	undo.fromSquare = static_cast<std::int8_t>(from);
+	undo.toSquare = static_cast<std::int8_t>(to);
+	undo.movedPiece = GetPieceAtSquare(from);
+
+	SetPieceAtSquare(from, PieceType::EMPTY);
+	if (move.IsCapture()) {
+		int captured = move.GetCapturedSquare();
+		undo.capturedSquare = static_cast<std::int8_t>(captured);
+		undo.capturedPiece = GetPieceAtSquare(captured);
+		SetPieceAtSquare(captured, PieceType::EMPTY);
+	}
+
+	// La coronacion se decide con la pieza que hay en el tablero, no con la guardada en el movimiento
+	PieceType finalPiece = undo.movedPiece;
+	if (undo.movedPiece == PieceType::P1_MAN && (BITBOARD_ROW_0 & SquareBit(to))) {
+		finalPiece = PieceType::P1_KING;
+	}
+	else if (undo.movedPiece == PieceType::P2_MAN && (BITBOARD_ROW_7 & SquareBit(to))) {
+		finalPiece = PieceType::P2_KING;
+	}
+	undo.promoted = (finalPiece != undo.movedPiece);
+	SetPieceAtSquare(to, finalPiece);
+	return undo;
+}
+
+// Deshace un movimiento en orden inverso a MakeMove
+void Board::UnmakeMove(const MoveUndo& undo) {
+	SetPieceAtSquare(undo.toSquare, PieceType::EMPTY);
+	if (undo.capturedSquare >= 0) {
+		SetPieceAtSquare(undo.capturedSquare, undo.capturedPiece);
+	}
+	SetPieceAtSquare(undo.fromSquare, undo.movedPiece);
+}
+
+// Escribe la posicion como texto (ver el formato en Board.h)
+std::string Board::ToPositionString() const {
+	std::string position = (mSideToMove == PlayerColor::PLAYER_2) ? "B:" : "W:";
+	for (int square = 0; square < NUM_PLAYABLE_SQUARES; ++square) {
+		switch (GetPieceAtSquare(square)) {
+		case PieceType::P1_MAN: position += 'w'; break;
+		case PieceType::P1_KING: position += 'W'; break;
+		case PieceType::P2_MAN: position += 'b'; break;
+		case PieceType::P2_KING: position += 'B'; break;
+		default: position += '.'; break;
+		}
+	}
+	return position;
+}
+
+// Lee una posicion en texto. Se valida todo antes de tocar el tablero.
+bool Board::LoadPositionString(const std::string& position) {
+	if (position.size() != 2 + NUM_PLAYABLE_SQUARES || position[1] != ':' ||
+		(position[0] != 'W' && position[0] != 'B')) {
+		return false;
+	}
+	PieceType pieces[NUM_PLAYABLE_SQUARES];
+	for (int square = 0; square < NUM_PLAYABLE_SQUARES; ++square) {
+		switch (position[2 + square]) {
+		case 'w': pieces[square] = PieceType::P1_MAN; break;
+		case 'W': pieces[square] = PieceType::P1_KING; break;
+		case 'b': pieces[square] = PieceType::P2_MAN; break;
+		case 'B': pieces[square] = PieceType::P2_KING; break;
+		case '.': pieces[square] = PieceType::EMPTY; break;
+		default: return false;
+		}
+	}
+
+	ClearBoard();
+	ResetPieceCounts();
+	mHashKey = 0;
+	mSideToMove = PlayerColor::PLAYER_1;
+	for (int square = 0; square < NUM_PLAYABLE_SQUARES; ++square) {
+		SetPieceAtSquare(square, pieces[square]);
+	}
+	SetSideToMove((position[0] == 'B') ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1);
+	return true;
+}
+
 // --- Implementacion de Metodos Privados ---
 // Limpia el tablero, dejando todas las casillas vacias
 void Board::ClearBoard() {
-	for (int r = 0; r < BOARD_SIZE; ++r) {
-		for (int c = 0; c < BOARD_SIZE; ++c) {
-			mGrid[r][c] = PieceType::EMPTY;
-		}
+	for (int i = 0; i < 4; ++i) {
+		mPieceBitboards[i] = 0;
 	}
+	mEmptySquares = BITBOARD_ALL_SQUARES;
 }
 
-// Resetea los contadores de piezas de ambos jugadores
+// Resetea los contadores de piezas y los acumuladores de evaluacion de ambos jugadores
 void Board::ResetPieceCounts() {
 	for (int i = 0; i < 2; ++i) {
 		for (int j = 0; j < 2; ++j) {
 			mPieceCounts[i][j] = 0;
 		}
+		mEvaluationAccumulators[i] = 0;
 	}
 }
 
 // Actualiza los contadores de piezas al cambiar una pieza en el tablero
-void Board::UpdateCountsForSetPiece(int r, int c, PieceType oldPiece, PieceType newPiece) {
+void Board::UpdateCountsForSetPiece(PieceType oldPiece, PieceType newPiece) {
 	int playerIndexOld = -1, pieceTypeIndexOld = -1;
 	if (oldPiece == PieceType::P1_MAN) { playerIndexOld = 0; pieceTypeIndexOld = 0; }
 	else if (oldPiece == PieceType::P1_KING) { playerIndexOld = 0; pieceTypeIndexOld = 1; }
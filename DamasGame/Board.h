@@ -2,13 +2,29 @@
 #define BOARD_H
 
 #include "CommonTypes.h" // Para PieceType, PlayerColor
+#include "Bitboard.h"    // Para Bitboard y utilidades de bits
 #include <array>
-#include <vector>     
-#include <string>       
+#include <vector>
+#include <string>
+#include <cstdint>
+
+struct CompactMove; // Movimiento elemental empaquetado (ver CompactMove.h)
+
+// Registro compacto para deshacer un movimiento elemental aplicado con Board::MakeMove.
+// Guarda solo lo que el movimiento cambia: las dos casillas de la pieza, la pieza capturada y la coronacion.
+struct MoveUndo {
+	std::int8_t fromSquare = -1;     // Casilla de origen de la pieza
+	std::int8_t toSquare = -1;       // Casilla de destino de la pieza
+	std::int8_t capturedSquare = -1; // Casilla de la pieza capturada (-1 si no hubo captura)
+	PieceType movedPiece = PieceType::EMPTY;    // Pieza tal como estaba antes de moverse (antes de coronar)
+	PieceType capturedPiece = PieceType::EMPTY; // Pieza retirada del tablero
+	bool promoted = false;           // Indica si la pieza corono al llegar al destino
+};
 
 class Board {
 public:
 	static constexpr int BOARD_SIZE = 8; // Tamano del tablero (8x8)
+	static constexpr int NUM_PLAYABLE_SQUARES = 32; // Cantidad de casillas jugables (oscuras)
 
 	// Constructor: inicializa el tablero y los contadores
 	Board();
@@ -22,6 +38,12 @@ public:
 	// Coloca una pieza en una coordenada y actualiza los contadores
 	void SetPieceAt(int row, int col, PieceType pieceType);
 
+	// Devuelve el tipo de pieza en una casilla jugable (indice 0..31)
+	PieceType GetPieceAtSquare(int square) const;
+
+	// Coloca una pieza en una casilla jugable (indice 0..31) y actualiza mascaras y contadores
+	void SetPieceAtSquare(int square, PieceType pieceType);
+
 	// Verifica si las coordenadas estan dentro del tablero
 	bool IsWithinBounds(int row, int col) const;
 
@@ -37,18 +59,88 @@ public:
 	// Promueve una pieza a dama si llega a la fila de coronacion
 	void PromotePieceIfNecessary(int row, int col);
 
+	// --- Hacer / deshacer movimientos ---
+	// Aplica un movimiento elemental (un paso o un salto) ya validado: mueve la pieza, retira la
+	// capturada si es un salto y corona si corresponde. Devuelve lo necesario para deshacerlo.
+	// No cambia el bando que mueve: en una cadena de capturas el turno sigue siendo del mismo jugador.
+	MoveUndo MakeMove(const Move& move);
+	// Igual que MakeMove(const Move&) con el movimiento empaquetado; trabaja directamente con casillas
+	// jugables, sin pasar por filas y columnas (es el que usa la busqueda)
+	MoveUndo MakeMove(CompactMove move);
+	// Restaura exactamente la posicion anterior a MakeMove (piezas, contadores y clave Zobrist)
+	void UnmakeMove(const MoveUndo& undo);
+
+	// --- Acceso a las mascaras de bits ---
+	// Devuelve la mascara de casillas ocupadas por un tipo de pieza (EMPTY devuelve las casillas vacias)
+	Bitboard GetPieceBitboard(PieceType pieceType) const;
+	// Devuelve la mascara con todas las piezas (peones + damas) de un jugador
+	Bitboard GetPlayerBitboard(PlayerColor player) const;
+	// Devuelve la mascara de casillas jugables vacias
+	Bitboard GetEmptyBitboard() const { return mEmptySquares; }
+	// Devuelve la mascara de casillas jugables ocupadas por cualquier pieza
+	Bitboard GetOccupiedBitboard() const { return ~mEmptySquares; }
+
+	// --- Evaluacion incremental ---
+	// Devuelve la suma del valor de material y de posicion de las piezas de un jugador, con los pesos de
+	// Evaluator. Se mantiene al colocar o quitar cada pieza (igual que los contadores), asi que evaluar
+	// una hoja es restar los acumuladores de los dos bandos.
+	int GetEvaluationAccumulator(PlayerColor player) const;
+	// Recalcula el acumulador de un jugador desde cero recorriendo sus piezas (util para verificaciones)
+	int ComputeEvaluationAccumulator(PlayerColor player) const;
+
+	// --- Clave Zobrist ---
+	// Devuelve la clave de 64 bits que identifica la posicion (colocacion de piezas + bando que mueve).
+	// Se mantiene de forma incremental: cada cambio de casilla cuesta un XOR.
+	std::uint64_t GetHashKey() const { return mHashKey; }
+	// Recalcula la clave desde cero recorriendo las mascaras (util para verificaciones)
+	std::uint64_t ComputeHashKey() const;
+	// Devuelve el bando al que le toca mover
+	PlayerColor GetSideToMove() const { return mSideToMove; }
+	// Cambia el bando al que le toca mover y actualiza la clave
+	void SetSideToMove(PlayerColor player);
+
+	// --- Posiciones en texto ---
+	// Formato: bando que mueve ('W' Blancas / 'B' Negras), ':' y un caracter por casilla jugable (0..31):
+	// 'w' peon blanco, 'W' dama blanca, 'b' peon negro, 'B' dama negra, '.' vacia.
+	// Ejemplo (posicion inicial): "W:bbbbbbbbbbbb........wwwwwwwwwwww"
+	std::string ToPositionString() const;
+	// Carga una posicion en el formato anterior. Devuelve false (sin modificar el tablero) si el texto no es valido.
+	bool LoadPositionString(const std::string& position);
+
+	// --- Conversion entre coordenadas y casillas jugables ---
+	// Convierte (fila, columna) al indice de casilla jugable, o -1 si la casilla no es jugable
+	static constexpr int ToSquareIndex(int row, int col) {
+		return (row >= 0 && row < BOARD_SIZE && col >= 0 && col < BOARD_SIZE && (row % 2) != (col % 2))
+			? row * (BOARD_SIZE / 2) + col / 2
+			: -1;
+	}
+	// Devuelve la fila de una casilla jugable
+	static constexpr int SquareToRow(int square) { return square / (BOARD_SIZE / 2); }
+	// Devuelve la columna de una casilla jugable (en filas pares las casillas oscuras son las columnas impares)
+	static constexpr int SquareToCol(int square) {
+		return 2 * (square % (BOARD_SIZE / 2)) + ((SquareToRow(square) % 2 == 0) ? 1 : 0);
+	}
+
 private:
-	// Matriz que representa el tablero y el tipo de pieza en cada casilla
-	std::array<std::array<PieceType, BOARD_SIZE>, BOARD_SIZE> mGrid;
+	// Una mascara por tipo de pieza, indexada por PieceType (P1_MAN, P1_KING, P2_MAN, P2_KING)
+	Bitboard mPieceBitboards[4];
+	// Mascara de casillas jugables vacias
+	Bitboard mEmptySquares;
 	// Contadores de piezas: [jugador][tipo] -> [0=peon, 1=dama]
 	int mPieceCounts[2][2];
+	// Acumuladores de evaluacion (material + posicion) por jugador: [0=PLAYER_1, 1=PLAYER_2]
+	int mEvaluationAccumulators[2];
+	// Clave Zobrist de la posicion actual
+	std::uint64_t mHashKey;
+	// Bando al que le toca mover (forma parte de la clave)
+	PlayerColor mSideToMove;
 
 	// Limpia el tablero, dejando todas las casillas vacias
 	void ClearBoard();
-	// Resetea los contadores de piezas de ambos jugadores
+	// Resetea los contadores de piezas y los acumuladores de evaluacion de ambos jugadores
 	void ResetPieceCounts();
 	// Actualiza los contadores de piezas al cambiar una pieza en el tablero
-	void UpdateCountsForSetPiece(int r, int c, PieceType oldPiece, PieceType newPiece);
+	void UpdateCountsForSetPiece(PieceType oldPiece, PieceType newPiece);
 };
 
-#endif // BOARD_H
\ No newline at end of file
+#endif // BOARD_H
@@ -0,0 +1,90 @@
+#ifndef COMPACT_MOVE_H
+#define COMPACT_MOVE_H
+
+#include "CommonTypes.h" // Para Move, PieceType, PlayerColor
+#include "Board.h"       // Para la conversion entre casillas y coordenadas
+
+#include <cstdint>
+
+// Movimiento elemental empaquetado en 32 bits (Move ocupa 28 bytes).
+// Guarda las casillas jugables (0..31) en lugar de filas y columnas:
+//   bits  0-4   casilla de origen
+//   bits  5-9   casilla de destino
+//   bits 10-14  casilla de la pieza capturada (0 si no hay captura)
+//   bit  15     captura
+//   bit  16     coronacion (un peon que llega a la ultima fila)
+//   bits 17-19  pieza movida (PieceType)
+//   bits 20-21  jugador (PlayerColor)
+// El valor 0 es el movimiento nulo: ningun movimiento real tiene el mismo origen y destino.
+// La conversion desde y hacia Move no pierde informacion para cualquier movimiento entre casillas jugables.
+struct CompactMove {
+	std::uint32_t bits = 0;
+
+	CompactMove() = default;
+
+	// Construye el movimiento directamente con casillas jugables (capturedSquare = -1 si no hay captura)
+	CompactMove(int fromSquare, int toSquare, int capturedSquare, bool promotes, PieceType piece, PlayerColor player)
+		: bits(static_cast<std::uint32_t>(fromSquare) |
+			(static_cast<std::uint32_t>(toSquare) << TO_SHIFT) |
+			(capturedSquare >= 0 ? (static_cast<std::uint32_t>(capturedSquare) << CAPTURED_SHIFT) | CAPTURE_FLAG : 0u) |
+			(promotes ? PROMOTION_FLAG : 0u) |
+			(static_cast<std::uint32_t>(piece) << PIECE_SHIFT) |
+			(static_cast<std::uint32_t>(player) << PLAYER_SHIFT)) {
+	}
+
+	bool IsNull() const { return bits == 0; }
+	int GetFromSquare() const { return static_cast<int>(bits & SQUARE_MASK); }
+	int GetToSquare() const { return static_cast<int>((bits >> TO_SHIFT) & SQUARE_MASK); }
+	bool IsCapture() const { return (bits & CAPTURE_FLAG) != 0; }
+	// Casilla de la pieza capturada (-1 si no es una captura)
+	int GetCapturedSquare() const { return IsCapture() ? static_cast<int>((bits >> CAPTURED_SHIFT) & SQUARE_MASK) : -1; }
+	bool IsPromotion() const { return (bits & PROMOTION_FLAG) != 0; }
+	PieceType GetPiece() const { return static_cast<PieceType>((bits >> PIECE_SHIFT) & 0x7); }
+	PlayerColor GetPlayer() const { return static_cast<PlayerColor>((bits >> PLAYER_SHIFT) & 0x3); }
+
+	bool operator==(const CompactMove& other) const { return bits == other.bits; }
+	bool operator!=(const CompactMove& other) const { return bits != other.bits; }
+
+	// Empaqueta un movimiento elemental (un Move nulo da el movimiento nulo)
+	static CompactMove FromMove(const Move& move) {
+		if (move.IsNull()) {
+			return CompactMove();
+		}
+		int captured = move.isCapture_
+			? Board::ToSquareIndex((move.startR_ + move.endR_) / 2, (move.startC_ + move.endC_) / 2)
+			: -1;
+		bool promotes = (move.pieceMoved_ == PieceType::P1_MAN && move.endR_ == 0) ||
+			(move.pieceMoved_ == PieceType::P2_MAN && move.endR_ == Board::BOARD_SIZE - 1);
+		return CompactMove(Board::ToSquareIndex(move.startR_, move.startC_), Board::ToSquareIndex(move.endR_, move.endC_),
+			captured, promotes, move.pieceMoved_, move.playerColor_);
+	}
+
+	// Devuelve el Move equivalente (la coronacion se deduce de la pieza y la fila de destino)
+	Move ToMove() const {
+		Move move;
+		if (IsNull()) {
+			return move;
+		}
+		move.startR_ = Board::SquareToRow(GetFromSquare());
+		move.startC_ = Board::SquareToCol(GetFromSquare());
+		move.endR_ = Board::SquareToRow(GetToSquare());
+		move.endC_ = Board::SquareToCol(GetToSquare());
+		move.pieceMoved_ = GetPiece();
+		move.playerColor_ = GetPlayer();
+		move.isCapture_ = IsCapture();
+		return move;
+	}
+
+private:
+	static constexpr std::uint32_t SQUARE_MASK = 0x1F;
+	static constexpr int TO_SHIFT = 5;
+	static constexpr int CAPTURED_SHIFT = 10;
+	static constexpr std::uint32_t CAPTURE_FLAG = 1u << 15;
+	static constexpr std::uint32_t PROMOTION_FLAG = 1u << 16;
+	static constexpr int PIECE_SHIFT = 17;
+	static constexpr int PLAYER_SHIFT = 20;
+};
+
+static_assert(sizeof(CompactMove) == 4, "CompactMove debe ocupar 32 bits");
+
+#endif // COMPACT_MOVE_H
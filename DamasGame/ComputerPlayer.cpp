@@ -3,195 +3,109 @@
 #include "Board.h"       
 
 
-#include <vector>
 #include <algorithm> 
-#include <chrono>    
-#include <thread>    
 
 
 // Constructor de ComputerPlayer
-// Inicializa el jugador IA con un color, una referencia al generador de movimientos y la dificultad.
-// Tambien inicializa el generador de numeros aleatorios con una semilla basada en el tiempo actual.
-ComputerPlayer::ComputerPlayer(PlayerColor color, const MoveGenerator& moveGenerator, int difficulty)
-	: Player(color),
+// Inicializa el jugador IA con un color, la dificultad y el tamano de la tabla de transposicion;
+// el generador de movimientos lo usa el motor de busqueda.
+// AiPlayer siembra el generador de numeros aleatorios con una semilla basada en el tiempo actual.
+ComputerPlayer::ComputerPlayer(PlayerColor color, const MoveGenerator& moveGenerator, int difficulty, int transpositionTableSizeMb)
+	: AiPlayer(color),
 	m_difficulty(difficulty),
-	m_moveGeneratorRef(moveGenerator) { // Guardar referencia a MoveGenerator
-	// Sembrar el generador de numeros aleatorios con la hora actual
-	unsigned seed = static_cast<unsigned>(std::chrono::system_clock::now().time_since_epoch().count());
-	m_rng.seed(seed);
+	m_transpositionTable(transpositionTableSizeMb),
+	m_searchEngine(moveGenerator, &m_transpositionTable),
+	m_openingBook(nullptr) {
 }
 
-// Funcion de Evaluacion Heuristica
-// Devuelve una puntuacion para el tablero desde la perspectiva de 'perspectiveColor'.
-// Una puntuacion mas alta es mejor para 'perspectiveColor'.
-// Considera el valor de las piezas, su posicion y penalizaciones/bonificaciones simples.
-int ComputerPlayer::EvaluateBoardState(const Board& currentBoard, PlayerColor perspectiveColor) const {
-	int score = 0;
-	PlayerColor opponentColor = (perspectiveColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
-
-	const int pawnValue = 100; // Valor base de un peon
-	const int kingValue = 250; // Valor de una Dama (Rey)
-	const int advancementBonusBase = 5; // Bonificacion por cada fila avanzada
-	const int edgePenalty = -10; // Pequena penalizacion por estar en el borde (menos movilidad)
-
-	// Recorre todas las casillas del tablero
-	for (int r = 0; r < currentBoard.GetBoardSize(); ++r) {
-		for (int c = 0; c < currentBoard.GetBoardSize(); ++c) {
-			PieceType piece = currentBoard.GetPieceAt(r, c);
-			if (piece == PieceType::EMPTY) continue; // Ignora casillas vacias
-
-			// Determina el dueno de la pieza usando el generador de movimientos
-			PlayerColor pieceOwner = m_moveGeneratorRef.GetPlayerFromPiece(piece);
-			int pieceBaseValue = 0;
-			int positionalBonus = 0;
+// Traduce el nivel de dificultad a la profundidad de busqueda (en turnos completos).
+// Dificultad 1 -> 4 turnos, y cada nivel adicional suma 2 turnos.
+int ComputerPlayer::SearchDepthForDifficulty(int difficulty) {
+	const int minDifficulty = 1;
+	const int maxDifficulty = 5;
+	if (difficulty < minDifficulty) difficulty = minDifficulty;
+	if (difficulty > maxDifficulty) difficulty = maxDifficulty;
+	return 2 + 2 * difficulty;
+}
 
-			if (piece == PieceType::P1_MAN || piece == PieceType::P2_MAN) {
-				pieceBaseValue = pawnValue;
-				// Bonificacion por peones avanzados
-				if (pieceOwner == PlayerColor::PLAYER_1) { // Negras, avanzan hacia filas mayores
-					positionalBonus += advancementBonusBase * r;
-				}
-				else { // PlayerColor::PLAYER_2 (Blancas), avanzan hacia filas menores
-					positionalBonus += advancementBonusBase * (currentBoard.GetBoardSize() - 1 - r);
-				}
-			}
-			else { // Es Dama (Rey)
-				pieceBaseValue = kingValue;
-				// Las damas controlan mas el centro, pero es mas complejo de evaluar simplemente
-			}
+// Selecciona el movimiento completo que realizara la IA en su turno.
+// Los candidatos son movimientos completos (cadenas de captura enteras o movimientos simples), de modo que
+// una cadena se evalua por su resultado final y no solo por su primer salto. El mejor candidato se elige
+// con una busqueda alfa-beta cuya profundidad depende de la dificultad o, si hay control de tiempo, del reloj.
+// Si la posicion esta en el libro de aperturas, se juega uno de sus movimientos sin buscar.
+MoveSequence ComputerPlayer::ChooseSequence(const Board& board, bool isInCaptureSequence, const MoveSequenceList& legalMoves) {
+	// Cadenas completas con la prioridad Dama > Peon (solo las de la pieza obligada si hay una cadena en curso)
+	// o movimientos simples si no hay capturas. Se copian porque se barajan antes de buscar.
+	MoveSequenceList candidateMoves = legalMoves;
+
+	// Una sola copia del tablero por decision; dentro de la busqueda se hace y deshace sobre ella
+	Board searchBoard = board;
+	searchBoard.SetSideToMove(m_color);
+
+	// --- Libro de aperturas: una posicion conocida se juega sin buscar ---
+	// Solo al empezar el turno: el libro guarda movimientos completos, no posiciones a mitad de una cadena.
+	MoveSequence chosenSequence;
+	if (!isInCaptureSequence && ChooseBookMove(searchBoard.GetHashKey(), candidateMoves, chosenSequence)) {
+		return chosenSequence;
+	}
 
-			// Penalizacion si esta en un borde lateral (columnas 0 o ultima)
-			if (c == 0 || c == (currentBoard.GetBoardSize() - 1)) {
-				positionalBonus += edgePenalty;
-			}
-			// Se pueden anadir mas bonificaciones/penalizaciones aqui
+	// --- Busqueda alfa-beta sobre los movimientos completos ---
+	// Se barajan los candidatos para dar variedad: entre movimientos con la misma puntuacion
+	// la busqueda se queda con el primero que encuentra.
+	for (int i = candidateMoves.size() - 1; i > 0; --i) {
+		std::uniform_int_distribution<int> dist(0, i);
+		std::swap(candidateMoves[i], candidateMoves[dist(m_rng)]);
+	}
 
-			if (pieceOwner == perspectiveColor) { // Pieza de la IA (o del jugador cuya perspectiva evaluamos)
-				score += pieceBaseValue + positionalBonus;
-			}
-			else if (pieceOwner == opponentColor) { // Pieza del oponente
-				score -= (pieceBaseValue + positionalBonus);
-			}
-		}
+	SearchLimits limits;
+	limits.maxDepth = SearchDepthForDifficulty(m_difficulty);
+	limits.threads = m_searchThreads;
+	if (m_timeManager.IsActive()) {
+		limits.maxDepth = MAX_TIMED_SEARCH_DEPTH;
+		m_timeManager.AllocateMoveTime(limits);
 	}
-	return score;
+	return m_searchEngine.Search(searchBoard, m_color, candidateMoves, limits).bestMove;
 }
 
-// Selecciona el movimiento que realizara la IA en su turno.
-// Considera movimientos obligatorios, secuencias de captura y evalua cada posible movimiento usando la heuristica.
-// Devuelve un MoveInput con el movimiento elegido o invalido si no hay movimientos posibles.
-MoveInput ComputerPlayer::GetChosenMoveInput(
-	const Board& board,
-	const MoveGenerator& moveGenerator, // Parametro de la interfaz, aunque ya tenemos m_moveGeneratorRef
-	bool isInCaptureSequence,
-	int forcedRow,
-	int forcedCol,
-	const std::vector<Move>& availableMandatoryJumpsFromGameManager // Estos ya estan priorizados
-) {
-	MoveInput chosenAiMove;
-	chosenAiMove.isValidFormat = false; // Por defecto, si no se encuentra nada
-	chosenAiMove.wantsToExit = false;
-	chosenAiMove.wantsToShowStats = false;
-
-	std::vector<Move> candidateMoves;
-
-	if (isInCaptureSequence) {
-		// Si esta en una secuencia de captura, solo puede mover la pieza obligada
-		candidateMoves = availableMandatoryJumpsFromGameManager;
+// Consulta el libro y sortea entre los candidatos que aparecen en el. Cada movimiento pesa 2 por victoria
+// y 1 por empate del bando que lo jugo, asi que los que solo perdieron nunca se eligen.
+// Los codigos del libro se comparan con los candidatos legales, de modo que un libro de otra version
+// de las reglas nunca produce una jugada ilegal. Si dos candidatos tienen el mismo codigo dejan el mismo
+// tablero, asi que da igual cual se juegue.
+bool ComputerPlayer::ChooseBookMove(std::uint64_t key, const MoveSequenceList& candidateMoves, MoveSequence& outMove) {
+	if (m_openingBook == nullptr) {
+		return false;
 	}
-	else {
-		// No esta en secuencia, availableMandatoryJumpsFromGameManager contendra
-		// TODOS los saltos obligatorios (Dama > Peon). Si esta vacio, no hay capturas obligatorias.
-		if (!availableMandatoryJumpsFromGameManager.empty()) {
-			candidateMoves = availableMandatoryJumpsFromGameManager;
-		}
-		else {
-			// No hay capturas obligatorias, generar todos los movimientos simples posibles.
-			for (int r = 0; r < board.GetBoardSize(); ++r) {
-				for (int c = 0; c < board.GetBoardSize(); ++c) {
-					if (m_moveGeneratorRef.GetPlayerFromPiece(board.GetPieceAt(r, c)) == m_color) {
-						// Genera movimientos para la pieza si no hay saltos obligatorios
-						std::vector<Move> movesForPiece = m_moveGeneratorRef.GenerateMovesForPiece(board, r, c);
-						for (const auto& move : movesForPiece) {
-							if (!move.isCapture_) { // Solo movimientos simples
-								candidateMoves.push_back(move);
-							}
-						}
-					}
-				}
+	BookMoveStats bookMoves[MAX_BOOK_MOVES];
+	int bookMoveCount = m_openingBook->Lookup(key, bookMoves, MAX_BOOK_MOVES);
+
+	int candidateIndex[MAX_BOOK_MOVES];
+	std::uint64_t weights[MAX_BOOK_MOVES];
+	std::uint64_t totalWeight = 0;
+	for (int i = 0; i < bookMoveCount; ++i) {
+		candidateIndex[i] = -1;
+		weights[i] = 0;
+		for (int j = 0; j < candidateMoves.size(); ++j) {
+			if (OpeningBook::EncodeMove(candidateMoves[j]) == bookMoves[i].move) {
+				candidateIndex[i] = j;
+				weights[i] = 2 * static_cast<std::uint64_t>(bookMoves[i].wins) + bookMoves[i].draws;
+				break;
 			}
 		}
+		totalWeight += weights[i];
 	}
-
-	if (candidateMoves.empty()) {
-		// No hay movimientos validos (la IA esta bloqueada o es un error si HasAnyValidMoves dijo que si habia)
-		return chosenAiMove; // Devuelve isValidFormat = false
+	if (totalWeight == 0) {
+		return false;
 	}
 
-	// --- Evaluacion de Movimientos y Seleccion ---
-	Move bestMove; // Se inicializara en el primer bucle o si solo hay un candidato
-	int bestScore = std::numeric_limits<int>::min(); // El valor mas bajo posible para int
-
-	bool firstMoveEvaluated = false;
-
-	// Evalua cada movimiento candidato simulando el resultado y usando la heuristica
-	for (const Move& currentMove : candidateMoves) {
-		Board tempBoard = board;
-
-		// Simula el movimiento en un tablero temporal
-		PieceType pieceMoved = tempBoard.GetPieceAt(currentMove.startR_, currentMove.startC_);
-		tempBoard.SetPieceAt(currentMove.endR_, currentMove.endC_, pieceMoved);
-		tempBoard.SetPieceAt(currentMove.startR_, currentMove.startC_, PieceType::EMPTY);
-		if (currentMove.isCapture_) {
-			// Elimina la pieza capturada
-			int capturedR = currentMove.startR_ + (currentMove.endR_ - currentMove.startR_) / 2;
-			int capturedC = currentMove.startC_ + (currentMove.endC_ - currentMove.startC_) / 2;
-			tempBoard.SetPieceAt(capturedR, capturedC, PieceType::EMPTY);
-		}
-		tempBoard.PromotePieceIfNecessary(currentMove.endR_, currentMove.endC_);
-
-		int score = EvaluateBoardState(tempBoard, m_color);
-
-		// Desempate aleatorio simple: si dos movimientos tienen la misma mejor puntuacion,
-		// hay una probabilidad de elegir el nuevo.
-		if (!firstMoveEvaluated || score > bestScore) {
-			bestScore = score;
-			bestMove = currentMove;
-			firstMoveEvaluated = true;
-		}
-		else if (score == bestScore) {
-			// Si las puntuaciones son iguales, elegir al azar (50% de probabilidad de cambiar)
-			std::uniform_int_distribution<int> dist(0, 1);
-			if (dist(m_rng) == 0) {
-				bestMove = currentMove; // Sobrescribir con el nuevo movimiento
-			}
+	std::uniform_int_distribution<std::uint64_t> dist(0, totalWeight - 1);
+	std::uint64_t pick = dist(m_rng);
+	for (int i = 0; i < bookMoveCount; ++i) {
+		if (pick < weights[i]) {
+			outMove = candidateMoves[candidateIndex[i]];
+			return true;
 		}
+		pick -= weights[i];
 	}
-
-	if (!firstMoveEvaluated && !candidateMoves.empty()) {
-		// Esto podria pasar si todos los movimientos llevan a un estado con puntuacion min_int,
-		// o si hubo un error. Como fallback, tomar el primer movimiento candidato si existe.
-		bestMove = candidateMoves[0];
-		firstMoveEvaluated = true; // Para marcar que se ha elegido un bestMove
-	}
-
-	if (firstMoveEvaluated) { // Si se encontro un mejor movimiento
-		chosenAiMove.startRow = bestMove.startR_;
-		chosenAiMove.startCol = bestMove.startC_;
-		chosenAiMove.endRow = bestMove.endR_;
-		chosenAiMove.endCol = bestMove.endC_;
-		chosenAiMove.isValidFormat = true;
-	}
-	else {
-		// Si despues de todo, no se pudo determinar un bestMove 
-		chosenAiMove.isValidFormat = false;
-	}
-
-	// Simula un pequeno retraso para que la IA no sea instantanea
-	if (chosenAiMove.isValidFormat) { // Solo retrasar si la IA va a hacer un movimiento
-		std::uniform_int_distribution<int> delay_dist(200, 800); // Milisegundos
-		std::this_thread::sleep_for(std::chrono::milliseconds(delay_dist(m_rng)));
-	}
-
-	return chosenAiMove;
-}
\ No newline at end of file
+	return false;
+}
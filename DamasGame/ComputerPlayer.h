@@ -1,51 +1,62 @@
 #ifndef COMPUTER_PLAYER_H
 #define COMPUTER_PLAYER_H
 
-#include "Player.h"
+#include "AiPlayer.h"    // Clase base de las IA (cadenas salto a salto, reloj y pausa)
 #include "MoveGenerator.h" 
-#include <random>          // Para std::mt19937 si se quiere aleatoriedad en desempates
-#include <vector>          // Para std::vector
-#include <limits>          // Para std::numeric_limits
+#include "MoveSequence.h"  // Para MoveSequence (cadenas de captura completas)
+#include "SearchEngine.h"  // Para la busqueda alfa-beta
+#include "TranspositionTable.h" // Para la tabla de transposicion de la busqueda
+#include "EndgameTablebase.h" // Para jugar los finales con pocas piezas de forma perfecta
+#include "OpeningBook.h"   // Para jugar las aperturas conocidas sin buscar
 
 // Clase que representa a un jugador controlado por la computadora (IA)
 // Esta clase implementa la logica para que la computadora pueda tomar decisiones de movimiento
-// utilizando un generador de movimientos y una funcion heuristica de evaluacion.
-class ComputerPlayer : public Player {
+// utilizando un generador de movimientos y una busqueda alfa-beta con profundizacion iterativa.
+class ComputerPlayer : public AiPlayer {
 public:
 	// Constructor de ComputerPlayer
 	// color: color asignado al jugador (blanco o negro)
-	// moveGenerator: referencia al generador de movimientos para calcular posibles jugadas
-	// difficulty: nivel de dificultad de la IA (por defecto 1)
-	ComputerPlayer(PlayerColor color, const MoveGenerator& moveGenerator, int difficulty = 1);
-
-	// Metodo que decide el movimiento de la computadora en su turno
-	// board: estado actual del tablero
-	// moveGenerator: referencia al generador de movimientos
-	// isInCaptureSequence: indica si el jugador esta en una secuencia de capturas obligatorias
-	// forcedRow, forcedCol: posicion desde donde debe continuar la captura (si aplica)
-	// availableMandatoryJumps: lista de movimientos de captura obligatorios disponibles
-	// Retorna un MoveInput con la jugada seleccionada por la IA
-	MoveInput GetChosenMoveInput(
-		const Board& board,
-		const MoveGenerator& moveGenerator,
-		bool isInCaptureSequence,
-		int forcedRow,
-		int forcedCol,
-		const std::vector<Move>& availableMandatoryJumps
-	) override;
+	// moveGenerator: reglas de movimiento que usa la busqueda alfa-beta
+	// difficulty: nivel de dificultad de la IA (por defecto 1), determina la profundidad de busqueda
+	// transpositionTableSizeMb: tamano en MB de la tabla de transposicion de la busqueda
+	ComputerPlayer(PlayerColor color, const MoveGenerator& moveGenerator, int difficulty = 1,
+		int transpositionTableSizeMb = TranspositionTable::DEFAULT_SIZE_MB);
+
+	// Devuelve la profundidad de busqueda (en turnos completos) asociada a un nivel de dificultad
+	static int SearchDepthForDifficulty(int difficulty);
+
+	// Tablas de finales que consulta la busqueda (nullptr para no usarlas). El jugador no las posee:
+	// se cargan una vez y se comparten entre jugadores.
+	void SetEndgameTablebase(const EndgameTablebase* tablebase) { m_searchEngine.SetTablebase(tablebase); }
+
+	// Libro de aperturas que se consulta antes de buscar (nullptr para no usarlo). Igual que las tablas,
+	// el jugador no lo posee.
+	void SetOpeningBook(const OpeningBook* openingBook) { m_openingBook = openingBook; }
+
+	static constexpr int MAX_TIMED_SEARCH_DEPTH = 64; // Profundidad maxima cuando la busqueda la limita el tiempo
+	static constexpr int MAX_BOOK_MOVES = 32;         // Movimientos del libro que se consideran por posicion
+
+protected:
+	// Elige el movimiento completo del turno: del libro de aperturas si la posicion esta en el o con una
+	// busqueda alfa-beta cuya profundidad depende de la dificultad o, con control de tiempo, del reloj
+	// (hasta MAX_TIMED_SEARCH_DEPTH).
+	MoveSequence ChooseSequence(const Board& board, bool isInCaptureSequence, const MoveSequenceList& legalMoves) override;
 
 private:
 	int m_difficulty;                   // Nivel de dificultad de la IA (mayor valor implica mejor evaluacion y profundidad)
-	const MoveGenerator& m_moveGeneratorRef; // Referencia constante al generador de movimientos para calcular jugadas
 
-	// Generador de numeros aleatorios para desempates o para dar variedad a la IA
-	std::mt19937 m_rng;
+	// Tabla de transposicion usada por el motor de busqueda (se conserva entre turnos)
+	TranspositionTable m_transpositionTable;
+
+	// Motor de busqueda alfa-beta que elige el mejor movimiento completo
+	SearchEngine m_searchEngine;
+
+	// Libro de aperturas compartido (nullptr si no hay)
+	const OpeningBook* m_openingBook;
 
-	// Funcion heuristica que evalua el estado del tablero desde la perspectiva de un color
-	// currentBoard: tablero a evaluar
-	// perspectiveColor: color para el cual se evalua la posicion
-	// Retorna un valor numerico que representa la ventaja o desventaja
-	int EvaluateBoardState(const Board& currentBoard, PlayerColor perspectiveColor) const;
+	// Elige al azar uno de los candidatos que el libro tiene para la posicion 'key', con mas peso para los
+	// que mas ganaron. Devuelve false si la posicion no esta en el libro o ningun movimiento vale la pena.
+	bool ChooseBookMove(std::uint64_t key, const MoveSequenceList& candidateMoves, MoveSequence& outMove);
 };
 
 #endif // COMPUTER_PLAYER_H
\ No newline at end of file
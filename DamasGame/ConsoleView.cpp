@@ -156,7 +156,8 @@ void ConsoleView::DisplayMessage(const std::string& message, bool newLine, int f
 
 // Muestra el menu principal con arte ASCII y opciones
 // selectedOption: opcion resaltada
-void ConsoleView::DisplayMainMenu(int selectedOption) const {
+// aiEngineName: nombre del motor de IA elegido
+void ConsoleView::DisplayMainMenu(int selectedOption, const std::string& aiEngineName) const {
 	GoToXY(0, 0);
 
 	int consoleWidth = 80;
@@ -190,6 +191,7 @@ void ConsoleView::DisplayMainMenu(int selectedOption) const {
 		m_i18n.GetString("menu_opt_pvp"),
 		m_i18n.GetString("menu_opt_pvc"),
 		m_i18n.GetString("menu_opt_cvc"),
+		m_i18n.GetString("menu_opt_ai_engine", { { "engine", aiEngineName } }),
 		m_i18n.GetString("menu_opt_stats"),
 		m_i18n.GetString("menu_opt_exit"),
 	};
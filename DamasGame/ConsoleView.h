@@ -72,7 +72,8 @@ public:
 	void SetGameColorsAndClear() const;
 
 	// Muestra el menu principal y resalta la opcion seleccionada
-	void DisplayMainMenu(int selectedOption) const;
+	// aiEngineName: nombre del motor de IA elegido, que se muestra en su opcion
+	void DisplayMainMenu(int selectedOption, const std::string& aiEngineName) const;
 	// Muestra el tablero de juego en la consola
 	// gameBoard: referencia al tablero actual
 	// gameBgColor: color de fondo del tablero (por defecto negro)
@@ -15,11 +15,10 @@ int main() {
 	cursorInfo.bVisible = false;
 	SetConsoleCursorInfo(hConsoleOut, &cursorInfo);
 
-	Board gameBoard;
 	//ConsoleView view;
 	InputHandler inputHandler;
 
-	GameManager game(gameBoard,inputHandler);
+	GameManager game(inputHandler);
 	// Inicializar la aplicación
 	game.InitializeApplication(); // Esto maneja el menú y los bucles de juego
 
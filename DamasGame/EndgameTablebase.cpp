@@ -0,0 +1,253 @@
+#include "EndgameTablebase.h"
+#include "Board.h"
+#include "CommonTypes.h"
+
+#include <cstring> // Para std::memcmp
+
+namespace {
+	// Coeficientes binomiales C(n, k) para n <= 32 y k <= MAX_SUPPORTED_PIECES, calculados al compilar
+	struct BinomialTable {
+		std::uint64_t values[Board::NUM_PLAYABLE_SQUARES + 1][EndgameTablebase::MAX_SUPPORTED_PIECES + 1];
+	};
+
+	constexpr BinomialTable BuildBinomialTable() {
+		BinomialTable table{};
+		for (int n = 0; n <= Board::NUM_PLAYABLE_SQUARES; ++n) {
+			table.values[n][0] = 1;
+			for (int k = 1; k <= EndgameTablebase::MAX_SUPPORTED_PIECES; ++k) {
+				table.values[n][k] = (n == 0) ? 0 : table.values[n - 1][k - 1] + table.values[n - 1][k];
+			}
+		}
+		return table;
+	}
+
+	constexpr BinomialTable BINOMIALS = BuildBinomialTable();
+
+	std::uint64_t Binomial(int n, int k) {
+		return (k < 0 || n < 0) ? 0 : BINOMIALS.values[n][k];
+	}
+
+	// Invierte el orden de los 32 bits: la casilla s pasa a 31 - s (giro de 180 grados del tablero)
+	Bitboard RotateBitboard(Bitboard bb) {
+		bb = ((bb >> 1) & 0x55555555u) | ((bb & 0x55555555u) << 1);
+		bb = ((bb >> 2) & 0x33333333u) | ((bb & 0x33333333u) << 2);
+		bb = ((bb >> 4) & 0x0F0F0F0Fu) | ((bb & 0x0F0F0F0Fu) << 4);
+		bb = ((bb >> 8) & 0x00FF00FFu) | ((bb & 0x00FF00FFu) << 8);
+		return (bb >> 16) | (bb << 16);
+	}
+
+	// Rango colexicografico de las casillas de 'pieces' contadas solo entre las casillas libres 'free'
+	std::uint64_t RankSubset(Bitboard pieces, Bitboard free) {
+		std::uint64_t rank = 0;
+		int element = 1;
+		while (pieces) {
+			int square = PopLowestBit(pieces);
+			int compressed = PopCount(free & (SquareBit(square) - 1));
+			rank += Binomial(compressed, element++);
+		}
+		return rank;
+	}
+
+	// Operacion inversa de RankSubset: 'count' casillas elegidas entre las libres
+	Bitboard UnrankSubset(std::uint64_t rank, int count, Bitboard free) {
+		int freeCount = PopCount(free);
+		Bitboard pieces = 0;
+		int candidate = freeCount - 1;
+		for (int element = count; element >= 1; --element) {
+			while (Binomial(candidate, element) > rank) {
+				--candidate;
+			}
+			rank -= Binomial(candidate, element);
+			// La casilla libre numero 'candidate' (contando desde la mas baja)
+			Bitboard remaining = free;
+			for (int skip = 0; skip < candidate; ++skip) {
+				remaining &= remaining - 1;
+			}
+			pieces |= SquareBit(LowestBitIndex(remaining));
+			--candidate;
+		}
+		return pieces;
+	}
+}
+
+// Constructor de EndgameTablebase: sin tablas cargadas
+EndgameTablebase::EndgameTablebase()
+	: mFile(),
+	mMaxPieces(0),
+	mTableOffsets() {
+}
+
+// Proyecta el archivo y lee el directorio. Cada tabla se comprueba contra el tamano del archivo,
+// asi que una consulta nunca lee fuera de la proyeccion.
+bool EndgameTablebase::Load(const std::string& path) {
+	Unload();
+	if (!mFile.Open(path)) {
+		return false;
+	}
+	const unsigned char* data = mFile.GetData();
+	std::size_t size = mFile.GetSize();
+	if (size < static_cast<std::size_t>(HEADER_SIZE) || std::memcmp(data, FILE_MAGIC, 8) != 0) {
+		Unload();
+		return false;
+	}
+	int maxPieces = static_cast<int>(ReadUint32(data + 8));
+	std::uint64_t signatureCount = ReadUint32(data + 12);
+	if (maxPieces < 2 || maxPieces > MAX_SUPPORTED_PIECES ||
+		size < HEADER_SIZE + signatureCount * DIRECTORY_ENTRY_SIZE) {
+		Unload();
+		return false;
+	}
+
+	mTableOffsets.assign(SIGNATURE_CODE_COUNT, 0);
+	for (std::uint64_t i = 0; i < signatureCount; ++i) {
+		const unsigned char* entry = data + HEADER_SIZE + i * DIRECTORY_ENTRY_SIZE;
+		MaterialSignature signature;
+		signature.ownMen = entry[0];
+		signature.ownKings = entry[1];
+		signature.opponentMen = entry[2];
+		signature.opponentKings = entry[3];
+		std::uint64_t offset = ReadUint64(entry + 4);
+		std::uint64_t tableSize = ReadUint64(entry + 12);
+		if (signature.TotalPieces() > maxPieces || tableSize != SignatureSize(signature) ||
+			offset < HEADER_SIZE || offset > size || size - offset < tableSize) {
+			Unload();
+			return false;
+		}
+		mTableOffsets[SignatureCode(signature)] = offset;
+	}
+	mMaxPieces = maxPieces;
+	return true;
+}
+
+void EndgameTablebase::Unload() {
+	mFile.Close();
+	mMaxPieces = 0;
+	mTableOffsets.clear();
+}
+
+bool EndgameTablebase::Probe(const Board& board, PlayerColor sideToMove, TablebaseResult& outResult) const {
+	if (!IsLoaded()) {
+		return false;
+	}
+	int ownPieces = board.GetPieceCount(sideToMove);
+	int opponentPieces = board.GetPieceCount((sideToMove == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1);
+	if (ownPieces == 0 || opponentPieces == 0 || ownPieces + opponentPieces > mMaxPieces) {
+		return false;
+	}
+	NormalizedPosition position = Normalize(board, sideToMove);
+	std::uint64_t offset = mTableOffsets[SignatureCode(GetSignature(position))];
+	if (offset == 0) {
+		return false;
+	}
+	outResult = DecodeValue(mFile.GetData()[offset + IndexOf(position)]);
+	return true;
+}
+
+NormalizedPosition EndgameTablebase::Normalize(const Board& board, PlayerColor sideToMove) {
+	NormalizedPosition position;
+	if (sideToMove == PlayerColor::PLAYER_1) {
+		position.ownMen = board.GetPieceBitboard(PieceType::P1_MAN);
+		position.ownKings = board.GetPieceBitboard(PieceType::P1_KING);
+		position.opponentMen = board.GetPieceBitboard(PieceType::P2_MAN);
+		position.opponentKings = board.GetPieceBitboard(PieceType::P2_KING);
+	}
+	else {
+		position.ownMen = RotateBitboard(board.GetPieceBitboard(PieceType::P2_MAN));
+		position.ownKings = RotateBitboard(board.GetPieceBitboard(PieceType::P2_KING));
+		position.opponentMen = RotateBitboard(board.GetPieceBitboard(PieceType::P1_MAN));
+		position.opponentKings = RotateBitboard(board.GetPieceBitboard(PieceType::P1_KING));
+	}
+	return position;
+}
+
+NormalizedPosition EndgameTablebase::Flip(const NormalizedPosition& position) {
+	NormalizedPosition flipped;
+	flipped.ownMen = RotateBitboard(position.opponentMen);
+	flipped.ownKings = RotateBitboard(position.opponentKings);
+	flipped.opponentMen = RotateBitboard(position.ownMen);
+	flipped.opponentKings = RotateBitboard(position.ownKings);
+	return flipped;
+}
+
+MaterialSignature EndgameTablebase::GetSignature(const NormalizedPosition& position) {
+	MaterialSignature signature;
+	signature.ownMen = PopCount(position.ownMen);
+	signature.ownKings = PopCount(position.ownKings);
+	signature.opponentMen = PopCount(position.opponentMen);
+	signature.opponentKings = PopCount(position.opponentKings);
+	return signature;
+}
+
+int EndgameTablebase::SignatureCode(const MaterialSignature& signature) {
+	const int base = MAX_SUPPORTED_PIECES + 1;
+	return ((signature.ownMen * base + signature.ownKings) * base + signature.opponentMen) * base + signature.opponentKings;
+}
+
+std::uint64_t EndgameTablebase::SignatureSize(const MaterialSignature& signature) {
+	int free = Board::NUM_PLAYABLE_SQUARES;
+	std::uint64_t size = Binomial(free, signature.ownMen);
+	free -= signature.ownMen;
+	size *= Binomial(free, signature.ownKings);
+	free -= signature.ownKings;
+	size *= Binomial(free, signature.opponentMen);
+	free -= signature.opponentMen;
+	return size * Binomial(free, signature.opponentKings);
+}
+
+// Indice mixto: cada tipo de pieza se numera como combinacion de las casillas que dejaron libres
+// los tipos anteriores (peones propios, damas propias, peones rivales, damas rivales)
+std::uint64_t EndgameTablebase::IndexOf(const NormalizedPosition& position) {
+	Bitboard free = BITBOARD_ALL_SQUARES;
+	std::uint64_t index = RankSubset(position.ownMen, free);
+	free &= ~position.ownMen;
+	index = index * Binomial(PopCount(free), PopCount(position.ownKings)) + RankSubset(position.ownKings, free);
+	free &= ~position.ownKings;
+	index = index * Binomial(PopCount(free), PopCount(position.opponentMen)) + RankSubset(position.opponentMen, free);
+	free &= ~position.opponentMen;
+	return index * Binomial(PopCount(free), PopCount(position.opponentKings)) + RankSubset(position.opponentKings, free);
+}
+
+NormalizedPosition EndgameTablebase::PositionAt(const MaterialSignature& signature, std::uint64_t index) {
+	// Radices de cada tipo, en el mismo orden que IndexOf (los peones propios son la cifra mas alta)
+	int free = Board::NUM_PLAYABLE_SQUARES - signature.ownMen;
+	std::uint64_t ownKingsRadix = Binomial(free, signature.ownKings);
+	free -= signature.ownKings;
+	std::uint64_t opponentMenRadix = Binomial(free, signature.opponentMen);
+	free -= signature.opponentMen;
+	std::uint64_t opponentKingsRadix = Binomial(free, signature.opponentKings);
+
+	std::uint64_t opponentKingsRank = index % opponentKingsRadix;
+	index /= opponentKingsRadix;
+	std::uint64_t opponentMenRank = index % opponentMenRadix;
+	index /= opponentMenRadix;
+	std::uint64_t ownKingsRank = index % ownKingsRadix;
+	std::uint64_t ownMenRank = index / ownKingsRadix;
+
+	NormalizedPosition position;
+	Bitboard freeSquares = BITBOARD_ALL_SQUARES;
+	position.ownMen = UnrankSubset(ownMenRank, signature.ownMen, freeSquares);
+	freeSquares &= ~position.ownMen;
+	position.ownKings = UnrankSubset(ownKingsRank, signature.ownKings, freeSquares);
+	freeSquares &= ~position.ownKings;
+	position.opponentMen = UnrankSubset(opponentMenRank, signature.opponentMen, freeSquares);
+	freeSquares &= ~position.opponentMen;
+	position.opponentKings = UnrankSubset(opponentKingsRank, signature.opponentKings, freeSquares);
+	return position;
+}
+
+TablebaseResult EndgameTablebase::DecodeValue(std::uint8_t value) {
+	TablebaseResult result;
+	if (value == DRAW_VALUE) {
+		result.outcome = TablebaseOutcome::DRAW;
+		result.distance = 0;
+	}
+	else if (value < 128) {
+		result.outcome = TablebaseOutcome::WIN;
+		result.distance = 2 * value - 1;
+	}
+	else {
+		result.outcome = TablebaseOutcome::LOSS;
+		result.distance = 2 * (value - 128);
+	}
+	return result;
+}
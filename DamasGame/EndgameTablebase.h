@@ -0,0 +1,109 @@
+#ifndef ENDGAME_TABLEBASE_H
+#define ENDGAME_TABLEBASE_H
+
+#include "CommonTypes.h" // Para PlayerColor
+#include "Board.h"       // Para Board
+#include "Bitboard.h"    // Para Bitboard
+#include "MappedFile.h"  // Para proyectar el archivo de tablas en memoria y leer sus enteros
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Material de una posicion contado desde el bando que mueve
+struct MaterialSignature {
+	int ownMen = 0;        // Peones del bando que mueve
+	int ownKings = 0;      // Damas del bando que mueve
+	int opponentMen = 0;   // Peones del rival
+	int opponentKings = 0; // Damas del rival
+
+	int TotalPieces() const { return ownMen + ownKings + opponentMen + opponentKings; }
+};
+
+// Posicion normalizada: el bando que mueve siempre juega como las Blancas (corona en la fila 0).
+// Una posicion con las Negras al turno se gira 180 grados (casilla s -> 31 - s) y se cambian los colores.
+// Las reglas son simetricas, asi que el resultado no cambia y las tablas solo guardan un bando al turno.
+struct NormalizedPosition {
+	Bitboard ownMen = 0;
+	Bitboard ownKings = 0;
+	Bitboard opponentMen = 0;
+	Bitboard opponentKings = 0;
+};
+
+// Resultado teorico de una posicion para el bando que mueve
+enum class TablebaseOutcome {
+	DRAW, // Ninguno de los dos puede forzar la victoria
+	WIN,
+	LOSS
+};
+
+// Resultado de consultar una posicion en las tablas
+struct TablebaseResult {
+	TablebaseOutcome outcome = TablebaseOutcome::DRAW;
+	int distance = 0; // Turnos hasta el final de la partida con juego perfecto (0 en tablas)
+};
+
+// Tablas de finales: el resultado exacto (victoria, derrota o tablas) y la distancia al final de cada
+// posicion con pocas piezas, generadas por analisis retrogrado con la herramienta Tablebase.
+// Hay una tabla por firma de material; cada posicion ocupa un byte en el indice que le asigna IndexOf.
+// El archivo se proyecta en memoria al cargarlo, asi que consultar una posicion es leer un byte.
+//
+// Formato del archivo (enteros little-endian):
+//   cabecera:   "DAMASTB1" (8 bytes), maxPieces (uint32), cantidad de firmas (uint32)
+//   directorio: por firma, 4 bytes de material (peones y damas propias, peones y damas rivales),
+//               desplazamiento de su tabla desde el inicio del archivo (uint64) y tamano (uint64)
+//   datos:      las tablas, un byte por posicion (ver EncodeWin / EncodeLoss)
+class EndgameTablebase {
+public:
+	static constexpr int MAX_SUPPORTED_PIECES = 8; // Maximo de piezas que admite el formato
+	static constexpr int MAX_DISTANCE = 253;       // Distancia maxima que cabe en un byte
+	static constexpr const char* DEFAULT_FILENAME = "damas_endgame.tb";
+
+	static constexpr char FILE_MAGIC[9] = "DAMASTB1";
+	static constexpr int HEADER_SIZE = 16;
+	static constexpr int DIRECTORY_ENTRY_SIZE = 20;
+
+	EndgameTablebase();
+
+	// Proyecta un archivo de tablas. Devuelve false (sin tablas cargadas) si falta o no es valido.
+	bool Load(const std::string& path);
+	void Unload();
+	bool IsLoaded() const { return mFile.IsOpen(); }
+	// Piezas maximas (de ambos bandos) de las posiciones incluidas
+	int GetMaxPieces() const { return mMaxPieces; }
+
+	// Consulta la posicion del tablero con 'sideToMove' al turno, al empezar un turno (sin cadena en curso).
+	// Devuelve false si no hay tablas cargadas o la posicion no esta en ellas.
+	bool Probe(const Board& board, PlayerColor sideToMove, TablebaseResult& outResult) const;
+
+	// --- Indexado (compartido con el generador) ---
+	static NormalizedPosition Normalize(const Board& board, PlayerColor sideToMove);
+	// La misma posicion vista por el rival (como si le tocara mover a el)
+	static NormalizedPosition Flip(const NormalizedPosition& position);
+	static MaterialSignature GetSignature(const NormalizedPosition& position);
+	// Codigo compacto de una firma, para tablas de busqueda indexadas por material
+	static int SignatureCode(const MaterialSignature& signature);
+	static constexpr int SIGNATURE_CODE_COUNT = (MAX_SUPPORTED_PIECES + 1) * (MAX_SUPPORTED_PIECES + 1) * (MAX_SUPPORTED_PIECES + 1) * (MAX_SUPPORTED_PIECES + 1);
+	// Cantidad de posiciones de una firma: las piezas se colocan por tipo sobre las casillas que quedan libres
+	static std::uint64_t SignatureSize(const MaterialSignature& signature);
+	// Indice de la posicion dentro de la tabla de su firma (0 .. SignatureSize - 1)
+	static std::uint64_t IndexOf(const NormalizedPosition& position);
+	// Operacion inversa de IndexOf
+	static NormalizedPosition PositionAt(const MaterialSignature& signature, std::uint64_t index);
+
+	// --- Valores de un byte ---
+	// 0 = tablas, 1..127 = victoria, 128..255 = derrota. Las victorias siempre estan a una cantidad impar
+	// de turnos del final (el ganador hace el ultimo movimiento) y las derrotas a una cantidad par, asi que
+	// se guarda la mitad de la distancia: victoria en 2v - 1 turnos y derrota en 2(v - 128) turnos.
+	static constexpr std::uint8_t DRAW_VALUE = 0;
+	static constexpr std::uint8_t EncodeWin(int distance) { return static_cast<std::uint8_t>((distance + 1) / 2); }
+	static constexpr std::uint8_t EncodeLoss(int distance) { return static_cast<std::uint8_t>(128 + distance / 2); }
+	static TablebaseResult DecodeValue(std::uint8_t value);
+
+private:
+	MappedFile mFile; // Archivo de tablas proyectado
+	int mMaxPieces;   // Piezas maximas de las posiciones incluidas (0 sin tablas)
+	std::vector<std::uint64_t> mTableOffsets; // Desplazamiento de la tabla de cada firma (0 si no esta), por SignatureCode
+};
+
+#endif // ENDGAME_TABLEBASE_H
@@ -0,0 +1,272 @@
+#include "Evaluator.h"
+#include "Board.h"
+#include "CommonTypes.h"
+
+#include <cstdint>
+
+// Los nucleos vectoriales solo existen en x86/x64. En GCC/Clang cada nucleo se compila con su propio
+// atributo 'target' para no exigir opciones de compilacion; MSVC permite los intrinsecos sin ellas.
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define DAMAS_EVALUATOR_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h> // Para __cpuid, __cpuidex
+#define DAMAS_TARGET_SSE41
+#define DAMAS_TARGET_AVX2
+#else
+#define DAMAS_TARGET_SSE41 __attribute__((target("ssse3,sse4.1")))
+#define DAMAS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace {
+	// Para los lotes, la evaluacion de una posicion se escribe con conteos de bits sobre las mascaras:
+	//   peones de PLAYER_1: PAWN * n + AVANCE * suma(filas) + BORDE * n(en bordes)
+	//   peones de PLAYER_2: PAWN * n + AVANCE * (7 * n - suma(filas)) + BORDE * n(en bordes)
+	//   damas:              KING * n + BORDE * n(en bordes)
+	// La suma de filas sale de tres mascaras, una por bit del numero de fila:
+	//   suma(filas) = n(filas impares) + 2 * n(filas 2,3,6,7) + 4 * n(filas 4..7)
+	constexpr Bitboard ROW_BIT0_MASK = 0xF0F0F0F0u; // Filas 1, 3, 5, 7
+	constexpr Bitboard ROW_BIT1_MASK = 0xFF00FF00u; // Filas 2, 3, 6, 7
+	constexpr Bitboard ROW_BIT2_MASK = 0xFFFF0000u; // Filas 4, 5, 6, 7
+	constexpr Bitboard EDGE_MASK = BITBOARD_LEFT_EDGE | BITBOARD_RIGHT_EDGE;
+
+	constexpr bool CheckBatchMasks() {
+		for (int square = 0; square < Board::NUM_PLAYABLE_SQUARES; ++square) {
+			int r = Board::SquareToRow(square);
+			int c = Board::SquareToCol(square);
+			Bitboard bit = SquareBit(square);
+			if (((ROW_BIT0_MASK & bit) != 0) != ((r & 1) != 0)) return false;
+			if (((ROW_BIT1_MASK & bit) != 0) != ((r & 2) != 0)) return false;
+			if (((ROW_BIT2_MASK & bit) != 0) != ((r & 4) != 0)) return false;
+			if (((EDGE_MASK & bit) != 0) != (c == 0 || c == Board::BOARD_SIZE - 1)) return false;
+		}
+		return true;
+	}
+	static_assert(CheckBatchMasks(), "Las mascaras de la evaluacion por lotes no coinciden con las filas y bordes");
+
+	// Bloque de posiciones en formato SoA
+	constexpr std::size_t BATCH_BLOCK = 256;
+	struct BatchBlock {
+		alignas(32) Bitboard p1Men[BATCH_BLOCK];
+		alignas(32) Bitboard p1Kings[BATCH_BLOCK];
+		alignas(32) Bitboard p2Men[BATCH_BLOCK];
+		alignas(32) Bitboard p2Kings[BATCH_BLOCK];
+		alignas(32) std::int32_t negate[BATCH_BLOCK]; // -1 si mueve PLAYER_2 (el resultado se cambia de signo), 0 si no
+	};
+
+	void FillBlock(const Board* boards, std::size_t count, BatchBlock& block) {
+		for (std::size_t i = 0; i < count; ++i) {
+			block.p1Men[i] = boards[i].GetPieceBitboard(PieceType::P1_MAN);
+			block.p1Kings[i] = boards[i].GetPieceBitboard(PieceType::P1_KING);
+			block.p2Men[i] = boards[i].GetPieceBitboard(PieceType::P2_MAN);
+			block.p2Kings[i] = boards[i].GetPieceBitboard(PieceType::P2_KING);
+			block.negate[i] = (boards[i].GetSideToMove() == PlayerColor::PLAYER_2) ? -1 : 0;
+		}
+	}
+
+	int RowSum(Bitboard bb) {
+		return PopCount(bb & ROW_BIT0_MASK) + 2 * PopCount(bb & ROW_BIT1_MASK) + 4 * PopCount(bb & ROW_BIT2_MASK);
+	}
+
+	void EvaluateBlockScalar(const BatchBlock& block, std::size_t begin, std::size_t end, int* out) {
+		for (std::size_t i = begin; i < end; ++i) {
+			Bitboard m1 = block.p1Men[i], k1 = block.p1Kings[i], m2 = block.p2Men[i], k2 = block.p2Kings[i];
+			int men1 = PopCount(m1), men2 = PopCount(m2);
+			int p1 = Evaluator::PAWN_VALUE * men1 + Evaluator::ADVANCEMENT_BONUS_BASE * RowSum(m1)
+				+ Evaluator::KING_VALUE * PopCount(k1) + Evaluator::EDGE_PENALTY * PopCount((m1 | k1) & EDGE_MASK);
+			int p2 = Evaluator::PAWN_VALUE * men2 + Evaluator::ADVANCEMENT_BONUS_BASE * ((Board::BOARD_SIZE - 1) * men2 - RowSum(m2))
+				+ Evaluator::KING_VALUE * PopCount(k2) + Evaluator::EDGE_PENALTY * PopCount((m2 | k2) & EDGE_MASK);
+			int score = p1 - p2;
+			out[i] = (score ^ block.negate[i]) - block.negate[i];
+		}
+	}
+
+#ifdef DAMAS_EVALUATOR_X86
+	// Conteo de bits por carril de 32 bits: conteo por nibble con una tabla (pshufb) y suma de los
+	// cuatro bytes del carril con una multiplicacion por 0x01010101
+	DAMAS_TARGET_SSE41 inline __m128i PopCount32Sse(__m128i v) {
+		const __m128i table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		const __m128i lowNibbles = _mm_set1_epi8(0x0F);
+		__m128i low = _mm_and_si128(v, lowNibbles);
+		__m128i high = _mm_and_si128(_mm_srli_epi16(v, 4), lowNibbles);
+		__m128i bytes = _mm_add_epi8(_mm_shuffle_epi8(table, low), _mm_shuffle_epi8(table, high));
+		return _mm_srli_epi32(_mm_mullo_epi32(bytes, _mm_set1_epi32(0x01010101)), 24);
+	}
+
+	DAMAS_TARGET_SSE41 inline __m128i RowSumSse(__m128i bb) {
+		__m128i bit0 = PopCount32Sse(_mm_and_si128(bb, _mm_set1_epi32(static_cast<int>(ROW_BIT0_MASK))));
+		__m128i bit1 = PopCount32Sse(_mm_and_si128(bb, _mm_set1_epi32(static_cast<int>(ROW_BIT1_MASK))));
+		__m128i bit2 = PopCount32Sse(_mm_and_si128(bb, _mm_set1_epi32(static_cast<int>(ROW_BIT2_MASK))));
+		return _mm_add_epi32(bit0, _mm_add_epi32(_mm_slli_epi32(bit1, 1), _mm_slli_epi32(bit2, 2)));
+	}
+
+	DAMAS_TARGET_SSE41 std::size_t EvaluateBlockSse41(const BatchBlock& block, std::size_t count, int* out) {
+		const __m128i pawnValue = _mm_set1_epi32(Evaluator::PAWN_VALUE);
+		const __m128i kingValue = _mm_set1_epi32(Evaluator::KING_VALUE);
+		const __m128i advancement = _mm_set1_epi32(Evaluator::ADVANCEMENT_BONUS_BASE);
+		const __m128i edgePenalty = _mm_set1_epi32(Evaluator::EDGE_PENALTY);
+		const __m128i lastRow = _mm_set1_epi32(Board::BOARD_SIZE - 1);
+		const __m128i edgeMask = _mm_set1_epi32(static_cast<int>(EDGE_MASK));
+		std::size_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			__m128i m1 = _mm_load_si128(reinterpret_cast<const __m128i*>(block.p1Men + i));
+			__m128i k1 = _mm_load_si128(reinterpret_cast<const __m128i*>(block.p1Kings + i));
+			__m128i m2 = _mm_load_si128(reinterpret_cast<const __m128i*>(block.p2Men + i));
+			__m128i k2 = _mm_load_si128(reinterpret_cast<const __m128i*>(block.p2Kings + i));
+			__m128i negate = _mm_load_si128(reinterpret_cast<const __m128i*>(block.negate + i));
+
+			__m128i men2 = PopCount32Sse(m2);
+			__m128i p1 = _mm_add_epi32(
+				_mm_add_epi32(_mm_mullo_epi32(pawnValue, PopCount32Sse(m1)), _mm_mullo_epi32(advancement, RowSumSse(m1))),
+				_mm_add_epi32(_mm_mullo_epi32(kingValue, PopCount32Sse(k1)),
+					_mm_mullo_epi32(edgePenalty, PopCount32Sse(_mm_and_si128(_mm_or_si128(m1, k1), edgeMask)))));
+			__m128i p2 = _mm_add_epi32(
+				_mm_add_epi32(_mm_mullo_epi32(pawnValue, men2),
+					_mm_mullo_epi32(advancement, _mm_sub_epi32(_mm_mullo_epi32(lastRow, men2), RowSumSse(m2)))),
+				_mm_add_epi32(_mm_mullo_epi32(kingValue, PopCount32Sse(k2)),
+					_mm_mullo_epi32(edgePenalty, PopCount32Sse(_mm_and_si128(_mm_or_si128(m2, k2), edgeMask)))));
+			__m128i score = _mm_sub_epi32(_mm_xor_si128(_mm_sub_epi32(p1, p2), negate), negate);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), score);
+		}
+		return i;
+	}
+
+	DAMAS_TARGET_AVX2 inline __m256i PopCount32Avx2(__m256i v) {
+		const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+		__m256i low = _mm256_and_si256(v, lowNibbles);
+		__m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), lowNibbles);
+		__m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, low), _mm256_shuffle_epi8(table, high));
+		return _mm256_srli_epi32(_mm256_mullo_epi32(bytes, _mm256_set1_epi32(0x01010101)), 24);
+	}
+
+	DAMAS_TARGET_AVX2 inline __m256i RowSumAvx2(__m256i bb) {
+		__m256i bit0 = PopCount32Avx2(_mm256_and_si256(bb, _mm256_set1_epi32(static_cast<int>(ROW_BIT0_MASK))));
+		__m256i bit1 = PopCount32Avx2(_mm256_and_si256(bb, _mm256_set1_epi32(static_cast<int>(ROW_BIT1_MASK))));
+		__m256i bit2 = PopCount32Avx2(_mm256_and_si256(bb, _mm256_set1_epi32(static_cast<int>(ROW_BIT2_MASK))));
+		return _mm256_add_epi32(bit0, _mm256_add_epi32(_mm256_slli_epi32(bit1, 1), _mm256_slli_epi32(bit2, 2)));
+	}
+
+	DAMAS_TARGET_AVX2 std::size_t EvaluateBlockAvx2(const BatchBlock& block, std::size_t count, int* out) {
+		const __m256i pawnValue = _mm256_set1_epi32(Evaluator::PAWN_VALUE);
+		const __m256i kingValue = _mm256_set1_epi32(Evaluator::KING_VALUE);
+		const __m256i advancement = _mm256_set1_epi32(Evaluator::ADVANCEMENT_BONUS_BASE);
+		const __m256i edgePenalty = _mm256_set1_epi32(Evaluator::EDGE_PENALTY);
+		const __m256i lastRow = _mm256_set1_epi32(Board::BOARD_SIZE - 1);
+		const __m256i edgeMask = _mm256_set1_epi32(static_cast<int>(EDGE_MASK));
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			__m256i m1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.p1Men + i));
+			__m256i k1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.p1Kings + i));
+			__m256i m2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.p2Men + i));
+			__m256i k2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.p2Kings + i));
+			__m256i negate = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.negate + i));
+
+			__m256i men2 = PopCount32Avx2(m2);
+			__m256i p1 = _mm256_add_epi32(
+				_mm256_add_epi32(_mm256_mullo_epi32(pawnValue, PopCount32Avx2(m1)), _mm256_mullo_epi32(advancement, RowSumAvx2(m1))),
+				_mm256_add_epi32(_mm256_mullo_epi32(kingValue, PopCount32Avx2(k1)),
+					_mm256_mullo_epi32(edgePenalty, PopCount32Avx2(_mm256_and_si256(_mm256_or_si256(m1, k1), edgeMask)))));
+			__m256i p2 = _mm256_add_epi32(
+				_mm256_add_epi32(_mm256_mullo_epi32(pawnValue, men2),
+					_mm256_mullo_epi32(advancement, _mm256_sub_epi32(_mm256_mullo_epi32(lastRow, men2), RowSumAvx2(m2)))),
+				_mm256_add_epi32(_mm256_mullo_epi32(kingValue, PopCount32Avx2(k2)),
+					_mm256_mullo_epi32(edgePenalty, PopCount32Avx2(_mm256_and_si256(_mm256_or_si256(m2, k2), edgeMask)))));
+			__m256i score = _mm256_sub_epi32(_mm256_xor_si256(_mm256_sub_epi32(p1, p2), negate), negate);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), score);
+		}
+		return i;
+	}
+#endif
+
+	Evaluator::SimdLevel DetectSimdLevelOnce() {
+#ifdef DAMAS_EVALUATOR_X86
+#ifdef _MSC_VER
+		int info[4] = { 0, 0, 0, 0 };
+		__cpuid(info, 0);
+		int maxLeaf = info[0];
+		__cpuid(info, 1);
+		bool ssse3 = (info[2] & (1 << 9)) != 0;
+		bool sse41 = (info[2] & (1 << 19)) != 0;
+		bool osAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+		bool avx2 = false;
+		if (maxLeaf >= 7 && osAvx) {
+			__cpuidex(info, 7, 0);
+			avx2 = (info[1] & (1 << 5)) != 0;
+		}
+#else
+		__builtin_cpu_init();
+		bool ssse3 = __builtin_cpu_supports("ssse3");
+		bool sse41 = __builtin_cpu_supports("sse4.1");
+		bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+		if (avx2) return Evaluator::SimdLevel::AVX2;
+		if (ssse3 && sse41) return Evaluator::SimdLevel::SSE41;
+#endif
+		return Evaluator::SimdLevel::SCALAR;
+	}
+}
+
+// Constructor de Evaluator
+Evaluator::Evaluator() {
+	// No requiere inicializacion especial
+}
+
+// Funcion de Evaluacion Heuristica
+// Devuelve una puntuacion para el tablero desde la perspectiva de 'perspectiveColor'.
+// Una puntuacion mas alta es mejor para 'perspectiveColor'.
+// Considera el valor de las piezas, su posicion y penalizaciones/bonificaciones simples:
+// - cada peon vale PAWN_VALUE y cada dama KING_VALUE;
+// - un peon de PLAYER_1 suma ADVANCEMENT_BONUS_BASE * fila y uno de PLAYER_2,
+//   ADVANCEMENT_BONUS_BASE * (7 - fila);
+// - una pieza en un borde lateral (columna 0 o 7) suma EDGE_PENALTY.
+// Estos pesos estan precalculados por pieza y casilla en PIECE_SQUARE_TABLES (Evaluator.h).
+// El tablero mantiene la suma por jugador al mover cada pieza (Board::GetEvaluationAccumulator),
+// asi que aqui solo se restan.
+int Evaluator::EvaluateBoardState(const Board& currentBoard, PlayerColor perspectiveColor) const {
+	PlayerColor opponentColor = (perspectiveColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+	return currentBoard.GetEvaluationAccumulator(perspectiveColor) - currentBoard.GetEvaluationAccumulator(opponentColor);
+}
+
+// Se detecta una sola vez (inicializacion de variable estatica local, segura entre hilos)
+Evaluator::SimdLevel Evaluator::DetectSimdLevel() {
+	static const SimdLevel level = DetectSimdLevelOnce();
+	return level;
+}
+
+const char* Evaluator::SimdLevelName(SimdLevel level) {
+	switch (level) {
+	case SimdLevel::AVX2: return "AVX2";
+	case SimdLevel::SSE41: return "SSE4.1";
+	default: return "escalar";
+	}
+}
+
+void Evaluator::EvaluateBatch(const Board* boards, std::size_t n, int* out) const {
+	EvaluateBatch(boards, n, out, DetectSimdLevel());
+}
+
+// Evalua por bloques: copia un bloque a formato SoA, lo recorre con el nucleo vectorial
+// y termina las posiciones sobrantes (menos que el ancho del vector) con el nucleo escalar
+void Evaluator::EvaluateBatch(const Board* boards, std::size_t n, int* out, SimdLevel level) const {
+	if (level > DetectSimdLevel()) {
+		level = DetectSimdLevel();
+	}
+	BatchBlock block;
+	for (std::size_t start = 0; start < n; start += BATCH_BLOCK) {
+		std::size_t count = (n - start < BATCH_BLOCK) ? n - start : BATCH_BLOCK;
+		FillBlock(boards + start, count, block);
+		std::size_t done = 0;
+#ifdef DAMAS_EVALUATOR_X86
+		if (level == SimdLevel::AVX2) {
+			done = EvaluateBlockAvx2(block, count, out + start);
+		}
+		else if (level == SimdLevel::SSE41) {
+			done = EvaluateBlockSse41(block, count, out + start);
+		}
+#endif
+		EvaluateBlockScalar(block, done, count, out + start);
+	}
+}
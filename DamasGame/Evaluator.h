@@ -0,0 +1,83 @@
+#ifndef EVALUATOR_H
+#define EVALUATOR_H
+
+#include "CommonTypes.h" // Para PlayerColor, PieceType
+#include "Board.h"       // Para const Board&
+
+#include <cstddef>       // Para std::size_t
+
+// Clase responsable de la evaluacion heuristica estatica de una posicion.
+// La usa el motor de busqueda en las hojas del arbol.
+class Evaluator {
+public:
+	static constexpr int PAWN_VALUE = 100;             // Valor base de un peon
+	static constexpr int KING_VALUE = 250;             // Valor de una Dama (Rey)
+	static constexpr int ADVANCEMENT_BONUS_BASE = 5;   // Bonificacion por cada fila avanzada
+	static constexpr int EDGE_PENALTY = -10;           // Pequena penalizacion por estar en el borde (menos movilidad)
+
+	Evaluator();
+
+	// Funcion heuristica que evalua el estado del tablero desde la perspectiva de un color
+	// currentBoard: tablero a evaluar
+	// perspectiveColor: color para el cual se evalua la posicion
+	// Retorna un valor numerico que representa la ventaja o desventaja
+	int EvaluateBoardState(const Board& currentBoard, PlayerColor perspectiveColor) const;
+
+	// --- Evaluacion por lotes ---
+	// Instrucciones vectoriales usadas por EvaluateBatch
+	enum class SimdLevel {
+		SCALAR, // Sin instrucciones vectoriales
+		SSE41,  // 4 posiciones por instruccion (SSSE3 + SSE4.1)
+		AVX2    // 8 posiciones por instruccion
+	};
+	// Mejor nivel que soporta el procesador (se detecta una sola vez)
+	static SimdLevel DetectSimdLevel();
+	static const char* SimdLevelName(SimdLevel level);
+
+	// Evalua 'n' posiciones de una vez, cada una desde la perspectiva del bando que mueve en ese tablero:
+	// out[i] == EvaluateBoardState(boards[i], boards[i].GetSideToMove()).
+	// Las posiciones se copian por bloques a formato SoA (un arreglo por tipo de pieza) y cada termino se
+	// calcula como una suma de conteos de bits pesados, varias posiciones por instruccion.
+	void EvaluateBatch(const Board* boards, std::size_t n, int* out) const;
+	// Igual, con un nivel concreto (si el procesador no lo soporta se usa el mejor disponible por debajo)
+	void EvaluateBatch(const Board* boards, std::size_t n, int* out, SimdLevel level) const;
+};
+
+// Tablas de pieza-casilla: el valor (material + posicion) de cada tipo de pieza en cada casilla jugable,
+// generado en tiempo de compilacion a partir de las constantes de Evaluator.
+// - Peon: PAWN_VALUE + ADVANCEMENT_BONUS_BASE por fila (PLAYER_1 cuenta la fila, PLAYER_2 la fila desde abajo)
+// - Dama: KING_VALUE
+// - Cualquier pieza en un borde lateral (columna 0 o 7): + EDGE_PENALTY
+struct PieceSquareTables {
+	int values[4][Board::NUM_PLAYABLE_SQUARES]; // Indexado por PieceType (sin EMPTY) y casilla
+};
+
+constexpr PieceSquareTables BuildPieceSquareTables() {
+	PieceSquareTables tables{};
+	for (int square = 0; square < Board::NUM_PLAYABLE_SQUARES; ++square) {
+		int r = Board::SquareToRow(square);
+		int c = Board::SquareToCol(square);
+		int edge = (c == 0 || c == Board::BOARD_SIZE - 1) ? Evaluator::EDGE_PENALTY : 0;
+		tables.values[static_cast<int>(PieceType::P1_MAN)][square] = Evaluator::PAWN_VALUE + Evaluator::ADVANCEMENT_BONUS_BASE * r + edge;
+		tables.values[static_cast<int>(PieceType::P1_KING)][square] = Evaluator::KING_VALUE + edge;
+		tables.values[static_cast<int>(PieceType::P2_MAN)][square] = Evaluator::PAWN_VALUE + Evaluator::ADVANCEMENT_BONUS_BASE * (Board::BOARD_SIZE - 1 - r) + edge;
+		tables.values[static_cast<int>(PieceType::P2_KING)][square] = Evaluator::KING_VALUE + edge;
+	}
+	return tables;
+}
+
+inline constexpr PieceSquareTables PIECE_SQUARE_TABLES = BuildPieceSquareTables();
+
+// Valor de una pieza (no EMPTY) en una casilla jugable
+constexpr int PieceSquareValue(PieceType piece, int square) {
+	return PIECE_SQUARE_TABLES.values[static_cast<int>(piece)][square];
+}
+
+// Comprobaciones de los pesos: B8 (casilla 0, fila 0, columna 1), A7 (casilla 4, borde) y G1 (casilla 31, fila 7)
+static_assert(PieceSquareValue(PieceType::P1_MAN, 0) == 100, "Peon blanco en B8");
+static_assert(PieceSquareValue(PieceType::P2_MAN, 0) == 135, "Peon negro en B8");
+static_assert(PieceSquareValue(PieceType::P1_MAN, 4) == 95, "Peon blanco en A7");
+static_assert(PieceSquareValue(PieceType::P2_KING, 4) == 240, "Dama negra en A7");
+static_assert(PieceSquareValue(PieceType::P1_MAN, 31) == 135, "Peon blanco en G1");
+
+#endif // EVALUATOR_H
@@ -33,15 +33,8 @@ bool FileHandler::saveGameResult(const GameResult& result) {
         return false; // Indicar que fallo el guardado
     }
 
-    // Formatear la linea de texto segun la estructura:
-    // Fecha Hora;TipoJugador1 vs TipoJugador2;Ganador;RazonGanador;Turnos;CapturasGanador;CapturasPerdedor
-    outputFile << result.date << " " << result.time << ";"
-        << result.playerTypes << ";"
-        << result.winner << ";"
-        << result.reason << ";"
-        << result.totalTurns << ";"
-        << result.winnerCaptures << ";"
-        << result.loserCaptures << std::endl; // std::endl anade un salto de linea y vacia el buffer
+    // Formatear la linea de texto segun la estructura (ver FormatGameResultLine)
+    outputFile << FormatGameResultLine(result) << std::endl; // std::endl anade un salto de linea y vacia el buffer
 
     // Cerrar el archivo
     outputFile.close();
@@ -15,6 +15,18 @@ struct GameResult {
     int loserCaptures;          // Cantidad de capturas realizadas por el perdedor
 };
 
+// Da formato a un resultado como una linea del archivo de resultados:
+// Fecha Hora;TipoJugador1 vs TipoJugador2;Ganador;RazonGanador;Turnos;CapturasGanador;CapturasPerdedor
+inline std::string FormatGameResultLine(const GameResult& result) {
+    return result.date + " " + result.time + ";" +
+        result.playerTypes + ";" +
+        result.winner + ";" +
+        result.reason + ";" +
+        std::to_string(result.totalTurns) + ";" +
+        std::to_string(result.winnerCaptures) + ";" +
+        std::to_string(result.loserCaptures);
+}
+
 // Clase encargada de manejar la lectura y escritura de resultados de partidas en archivo
 class FileHandler {
 public:
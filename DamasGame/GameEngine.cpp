@@ -0,0 +1,203 @@
+#include "GameEngine.h"
+#include "Board.h"
+#include "CommonTypes.h"
+
+// Constructor de GameEngine: deja lista una partida desde la posicion inicial
+GameEngine::GameEngine()
+	: mBoard(),
+	mMoveGenerator(),
+	mCurrentPlayer(PlayerColor::PLAYER_1),
+	mStats(),
+	mLastMove(),
+	mIsOver(false),
+	mMaxTurns(0),
+	mInCaptureSequence(false),
+	mForcedPieceRow(-1),
+	mForcedPieceCol(-1) {
+	NewGame();
+}
+
+// Reinicia el tablero y todo el estado de la partida
+void GameEngine::NewGame() {
+	mBoard.InitializeBoard();
+	mCurrentPlayer = PlayerColor::PLAYER_1;
+	mStats = GameStats{};
+	mLastMove = Move{};
+	mIsOver = false;
+	mInCaptureSequence = false;
+	mForcedPieceRow = -1;
+	mForcedPieceCol = -1;
+	InvalidateLegalMoves();
+}
+
+// Genera los movimientos legales de 'player' si la cache no es de la posicion actual
+const GameEngine::LegalMoveCache& GameEngine::GetLegalMoveCache(PlayerColor player) const {
+	LegalMoveCache& cache = mLegalMoveCache;
+	if (cache.valid && cache.key == mBoard.GetHashKey() && cache.player == player) {
+		return cache;
+	}
+
+	cache.valid = true;
+	cache.key = mBoard.GetHashKey();
+	cache.player = player;
+	cache.sequencesValid = false;
+	if (mInCaptureSequence && player == mCurrentPlayer) {
+		cache.moves = mMoveGenerator.GetPossibleJumpsForSpecificPiece(mBoard, mForcedPieceRow, mForcedPieceCol);
+		PieceType forcedPiece = mBoard.GetPieceAt(mForcedPieceRow, mForcedPieceCol);
+		cache.actionType = (forcedPiece == PieceType::P1_KING || forcedPiece == PieceType::P2_KING) ? MandatoryActionType::KING_CAPTURE : MandatoryActionType::PAWN_CAPTURE;
+	}
+	else {
+		cache.actionType = mMoveGenerator.GenerateLegalMoves(mBoard, player, cache.moves);
+	}
+	for (Bitboard& targets : cache.targets) {
+		targets = 0;
+	}
+	for (const Move& move : cache.moves) {
+		cache.targets[Board::ToSquareIndex(move.startR_, move.startC_)] |= SquareBit(Board::ToSquareIndex(move.endR_, move.endC_));
+	}
+	return cache;
+}
+
+// Movimientos elementales legales del jugador en turno
+MandatoryActionType GameEngine::LegalMoves(MoveList& outMoves) const {
+	const LegalMoveCache& cache = GetLegalMoveCache(mCurrentPlayer);
+	outMoves = cache.moves;
+	return cache.actionType;
+}
+
+// Capturas obligatorias del jugador en turno. En una cadena en curso son los saltos de la pieza obligada.
+MandatoryActionType GameEngine::GetMandatoryMoves(MoveList& outMoves) const {
+	const LegalMoveCache& cache = GetLegalMoveCache(mCurrentPlayer);
+	outMoves.clear();
+	if (cache.actionType != MandatoryActionType::NONE) {
+		outMoves = cache.moves;
+	}
+	return cache.actionType;
+}
+
+// Movimientos completos del jugador en turno
+void GameEngine::LegalMoveSequences(MoveSequenceList& outSequences) const {
+	outSequences = GetLegalMoveSequences();
+}
+
+const MoveSequenceList& GameEngine::GetLegalMoveSequences() const {
+	GetLegalMoveCache(mCurrentPlayer);
+	LegalMoveCache& cache = mLegalMoveCache;
+	if (!cache.sequencesValid) {
+		if (mInCaptureSequence) {
+			mMoveGenerator.GenerateCaptureSequencesForPiece(mBoard, mForcedPieceRow, mForcedPieceCol, cache.sequences);
+		}
+		else {
+			mMoveGenerator.GenerateMoveSequences(mBoard, mCurrentPlayer, cache.sequences);
+		}
+		cache.sequencesValid = true;
+	}
+	return cache.sequences;
+}
+
+// Valida y aplica un movimiento elemental del jugador en turno.
+// La validacion es una consulta a la cache: el destino debe estar entre los legales de la casilla de origen.
+MoveResult GameEngine::ApplyMove(int startRow, int startCol, int endRow, int endCol) {
+	if (mIsOver) {
+		return MoveResult::GAME_ALREADY_OVER;
+	}
+	if (mInCaptureSequence && (startRow != mForcedPieceRow || startCol != mForcedPieceCol)) {
+		return MoveResult::NOT_FORCED_PIECE;
+	}
+
+	const LegalMoveCache& legalMoves = GetLegalMoveCache(mCurrentPlayer);
+	int from = Board::ToSquareIndex(startRow, startCol);
+	int to = Board::ToSquareIndex(endRow, endCol);
+	if (from < 0 || to < 0 || !(legalMoves.targets[from] & SquareBit(to))) {
+		return mInCaptureSequence ? MoveResult::INVALID_CONTINUATION : MoveResult::ILLEGAL_MOVE;
+	}
+	// Si hay capturas obligatorias todos los movimientos legales son capturas; si no, ninguno lo es
+	bool moveWasCapture = (legalMoves.actionType != MandatoryActionType::NONE);
+
+	Move move;
+	move.startR_ = startRow; move.startC_ = startCol; move.endR_ = endRow; move.endC_ = endCol;
+	move.pieceMoved_ = mBoard.GetPieceAt(startRow, startCol);
+	move.playerColor_ = mCurrentPlayer;
+	move.isCapture_ = moveWasCapture;
+
+	// Mueve la pieza, retira la capturada y corona si corresponde
+	mBoard.MakeMove(move);
+	InvalidateLegalMoves();
+	if (moveWasCapture) {
+		if (mCurrentPlayer == PlayerColor::PLAYER_1) mStats.player1CapturedCount++;
+		else mStats.player2CapturedCount++;
+	}
+	mLastMove = move;
+
+	// Tras una captura, la misma pieza debe seguir saltando si puede (sus saltos quedan en la cache)
+	if (moveWasCapture) {
+		mInCaptureSequence = true;
+		mForcedPieceRow = endRow;
+		mForcedPieceCol = endCol;
+		if (!GetLegalMoveCache(mCurrentPlayer).moves.empty()) {
+			return MoveResult::APPLIED;
+		}
+		InvalidateLegalMoves();
+	}
+	mInCaptureSequence = false;
+	FinishTurn();
+	return MoveResult::APPLIED;
+}
+
+MoveResult GameEngine::ApplyMove(const Move& move) {
+	return ApplyMove(move.startR_, move.startC_, move.endR_, move.endC_);
+}
+
+// Aplica un movimiento completo paso a paso, con la misma validacion que un movimiento introducido
+MoveResult GameEngine::ApplySequence(const MoveSequence& sequence) {
+	for (int step = 0; step < sequence.numSteps_; ++step) {
+		MoveResult result = ApplyMove(sequence.GetStep(step));
+		if (result != MoveResult::APPLIED) {
+			return result;
+		}
+	}
+	return MoveResult::APPLIED;
+}
+
+// Un jugador que no puede mover al empezar su turno pierde la partida
+bool GameEngine::CheckCurrentPlayerCanMove() {
+	if (mIsOver) {
+		return false;
+	}
+	if (!mInCaptureSequence && !mMoveGenerator.HasAnyValidMoves(mBoard, mCurrentPlayer)) {
+		EndGame((mCurrentPlayer == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1, GameOverReason::NO_MOVES);
+		return false;
+	}
+	return true;
+}
+
+// Termina la partida y descarta cualquier cadena de capturas pendiente
+void GameEngine::EndGame(PlayerColor winner, GameOverReason reason) {
+	mStats.winner = winner;
+	mStats.reason = reason;
+	mIsOver = true;
+	mInCaptureSequence = false;
+	InvalidateLegalMoves();
+}
+
+// Cierra el turno del jugador actual
+void GameEngine::FinishTurn() {
+	PlayerColor opponent = (mCurrentPlayer == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+	if (mBoard.GetPieceCount(opponent) == 0) {
+		EndGame(mCurrentPlayer, GameOverReason::NO_PIECES);
+	}
+	else if (!mMoveGenerator.HasAnyValidMoves(mBoard, opponent)) {
+		// El oponente no puede mover: gana el jugador actual (prueba de movilidad, sin generar sus movimientos;
+		// la cache se llena cuando se pidan al empezar su turno)
+		EndGame(mCurrentPlayer, GameOverReason::NO_MOVES);
+	}
+	else {
+		// Solo se incrementa el turno y se cambia de jugador si la partida sigue
+		mStats.currentTurnNumber++;
+		mCurrentPlayer = opponent;
+		mBoard.SetSideToMove(mCurrentPlayer); // Mantiene el turno dentro de la clave Zobrist
+		if (mMaxTurns > 0 && mStats.currentTurnNumber > mMaxTurns) {
+			EndGame(PlayerColor::NONE, GameOverReason::STALEMATE_BY_RULES);
+		}
+	}
+}
@@ -0,0 +1,116 @@
+#ifndef GAME_ENGINE_H
+#define GAME_ENGINE_H
+
+#include "CommonTypes.h"   // Para Move, PlayerColor, GameStats, GameOverReason
+#include "Board.h"         // Para Board
+#include "MoveGenerator.h" // Para MoveGenerator y MandatoryActionType
+#include "MoveList.h"      // Para MoveList
+#include "MoveSequence.h"  // Para MoveSequence y MoveSequenceList
+
+#include <cstdint>
+#include <vector>
+
+// Resultado de intentar aplicar un movimiento en GameEngine
+enum class MoveResult {
+	APPLIED,              // El movimiento se aplico
+	GAME_ALREADY_OVER,    // La partida ya termino; no se aplica nada
+	NOT_FORCED_PIECE,     // Hay una cadena de capturas en curso y se intento mover otra pieza
+	INVALID_CONTINUATION, // Hay una cadena de capturas en curso y el destino no es un salto valido
+	ILLEGAL_MOVE          // El movimiento no es legal en la posicion actual
+};
+
+// Nucleo del juego sin entrada/salida: tablero, reglas, turnos, cadenas de captura y estadisticas.
+// No depende de la consola, por lo que sirve tanto para GameManager como para partidas sin interfaz
+// (auto-juego, pruebas, servidores).
+// Los movimientos legales de la posicion actual se generan una sola vez y se guardan en una cache
+// (clave Zobrist del tablero y jugador). La validacion de movimientos y los candidatos de la IA se
+// responden desde ella; cada cambio del tablero la invalida. Para saber si un jugador puede mover no hace
+// falta la lista: se usa la prueba de movilidad de MoveGenerator::HasAnyValidMoves.
+class GameEngine {
+public:
+	GameEngine();
+
+	// Prepara una partida nueva desde la posicion inicial (empiezan las Blancas)
+	void NewGame();
+
+	// --- Estado de la partida ---
+	const Board& GetBoard() const { return mBoard; }
+	const MoveGenerator& GetMoveGenerator() const { return mMoveGenerator; }
+	PlayerColor GetCurrentPlayer() const { return mCurrentPlayer; }
+	const GameStats& GetStats() const { return mStats; }
+	const Move& GetLastMove() const { return mLastMove; }
+	bool IsOver() const { return mIsOver; }
+
+	// Cadena de capturas en curso: el jugador en turno debe seguir saltando con la pieza indicada
+	bool IsInCaptureSequence() const { return mInCaptureSequence; }
+	int GetForcedPieceRow() const { return mForcedPieceRow; }
+	int GetForcedPieceCol() const { return mForcedPieceCol; }
+
+	// --- Movimientos legales ---
+	// Movimientos elementales legales del jugador en turno (los saltos de la pieza obligada si hay una cadena en curso)
+	MandatoryActionType LegalMoves(MoveList& outMoves) const;
+	// Capturas obligatorias del jugador en turno (vacia si no hay obligacion) y el tipo de obligacion,
+	// con la misma semantica que MoveGenerator::GetMandatoryActionType
+	MandatoryActionType GetMandatoryMoves(MoveList& outMoves) const;
+	// Movimientos completos del jugador en turno (cadenas enteras); respeta la cadena en curso
+	void LegalMoveSequences(MoveSequenceList& outSequences) const;
+	// Igual que LegalMoveSequences, sin copiar la lista: la referencia vale hasta el siguiente cambio del tablero
+	const MoveSequenceList& GetLegalMoveSequences() const;
+
+	// --- Acciones ---
+	// Aplica un movimiento elemental (un paso o un salto) del jugador en turno si es legal.
+	// Si el salto permite seguir capturando, el turno continua con la misma pieza; si no, el turno
+	// termina, se comprueba el fin de la partida y pasa al oponente.
+	MoveResult ApplyMove(int startRow, int startCol, int endRow, int endCol);
+	MoveResult ApplyMove(const Move& move);
+	// Aplica todos los pasos de un movimiento completo. Se detiene en el primer paso que no sea legal.
+	MoveResult ApplySequence(const MoveSequence& sequence);
+
+	// Comprueba que el jugador en turno puede mover. Si no puede, termina la partida (pierde por NO_MOVES)
+	// y devuelve false.
+	bool CheckCurrentPlayerCanMove();
+	// Termina la partida con el ganador y la razon indicados (abandono, error de la IA, etc.)
+	void EndGame(PlayerColor winner, GameOverReason reason);
+
+	// Limite de turnos: al superarlo la partida termina en empate (STALEMATE_BY_RULES).
+	// 0 = sin limite (el juego de consola no tiene regla de empate).
+	void SetMaxTurns(int maxTurns) { mMaxTurns = maxTurns; }
+
+private:
+	Board mBoard;                 // Tablero de la partida
+	MoveGenerator mMoveGenerator; // Reglas de movimiento
+	PlayerColor mCurrentPlayer;   // Jugador en turno
+	GameStats mStats;             // Estadisticas de la partida
+	Move mLastMove;               // Ultimo movimiento elemental aplicado
+	bool mIsOver;                 // Indica si la partida termino
+	int mMaxTurns;                // Turnos maximos antes de declarar empate (0 = sin limite)
+
+	bool mInCaptureSequence; // Indica si hay una cadena de capturas en curso
+	int mForcedPieceRow;     // Fila de la pieza obligada a seguir capturando
+	int mForcedPieceCol;     // Columna de la pieza obligada a seguir capturando
+
+	// Movimientos legales de una posicion. Las secuencias completas solo se generan si alguien las pide
+	// (la IA), porque validar un movimiento humano no las necesita.
+	struct LegalMoveCache {
+		bool valid = false;
+		std::uint64_t key = 0;                     // Clave Zobrist del tablero al generarla
+		PlayerColor player = PlayerColor::NONE;    // Jugador cuyos movimientos guarda
+		MandatoryActionType actionType = MandatoryActionType::NONE; // Obligacion de captura de la posicion
+		MoveList moves;                            // Movimientos elementales legales
+		Bitboard targets[Board::NUM_PLAYABLE_SQUARES] = {}; // Destinos legales por casilla de origen
+		bool sequencesValid = false;               // Indica si 'sequences' esta generada
+		MoveSequenceList sequences;                // Movimientos completos del turno
+	};
+	mutable LegalMoveCache mLegalMoveCache;
+
+	// Devuelve los movimientos legales de 'player' en la posicion actual, generandolos si la cache no
+	// corresponde a esta posicion (o a este jugador). En una cadena en curso son los saltos de la pieza obligada.
+	const LegalMoveCache& GetLegalMoveCache(PlayerColor player) const;
+	// Descarta la cache; se llama en cada cambio del tablero o de la cadena de capturas en curso
+	void InvalidateLegalMoves() { mLegalMoveCache.valid = false; }
+
+	// Cierra el turno: comprueba si el oponente se quedo sin piezas o sin movimientos y, si no, le pasa el turno
+	void FinishTurn();
+};
+
+#endif // GAME_ENGINE_H
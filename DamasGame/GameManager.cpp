@@ -8,8 +8,10 @@
 #include "CommonTypes.h"
 #include "MoveGenerator.h"
 #include "Player.h"         
+#include "AiPlayer.h"       // Para pasar a la IA los movimientos completos del turno
 #include "HumanPlayer.h"    
 #include "ComputerPlayer.h" 
+#include "MctsComputerPlayer.h"
 #include "FileHandler.h" 
 
 #include <iostream>
@@ -31,20 +33,16 @@ const int CONSOLE_WIDTH_ASSUMED = 80;
 
 // Constructor de GameManager
 // Inicializa referencias a los objetos principales del juego y variables de estado
-GameManager::GameManager(Board& board, InputHandler& inputHandler)
-	: mGameBoard(board),
-	m_i18n(), 
+GameManager::GameManager(InputHandler& inputHandler)
+	: m_i18n(), 
 	mView(m_i18n), 
 	mInputHandler(inputHandler),
-	mMoveGenerator(),
 	mFileHandler(m_i18n),
-	mCurrentPlayerTurnColor(PlayerColor::PLAYER_1),
-	mIsGameOver(false),
-	mLastMove(),
-	mInCaptureSequence(false),
-	mForcedPieceRow(-1),
-	mForcedPieceCol(-1),
+	mEngine(),
+	mTablebase(),
+	mOpeningBook(),
 	mCurrentGameMode(GameMode::NONE),
+	mAiEngine(AiEngine::ALPHA_BETA),
 	m_player1(nullptr),
 	m_player2(nullptr),
 	m_currentPlayerObject(nullptr)
@@ -87,17 +85,19 @@ std::string GameManager::getCurrentDateTime(const std::string& format_string) {
 // Inicializa la aplicacion, permitiendo seleccionar el idioma y mostrando el menu principal
 void GameManager::InitializeApplication() { 
 	m_i18n.SelectLanguageUI(mView, mInputHandler); // Menu de seleccion de idiomas
+	mTablebase.Load(EndgameTablebase::DEFAULT_FILENAME); // Opcional: sin el archivo la IA busca tambien los finales
+	mOpeningBook.Load(OpeningBook::DEFAULT_FILENAME); // Opcional: sin el archivo la IA busca tambien las aperturas
 	ShowMainMenu(); 
 }
 
 // Muestra el menu principal y gestiona la seleccion de modo de juego o salida
 void GameManager::ShowMainMenu() {
 	int selectedOption = 1;
-	const int numMenuOptions = 5;
+	const int numMenuOptions = 6;
 	bool exitMenu = false;
 	while (!exitMenu) {
 		mView.SetMenuColorsAndClear();
-		mView.DisplayMainMenu(selectedOption);
+		mView.DisplayMainMenu(selectedOption, m_i18n.GetString(mAiEngine == AiEngine::MCTS ? "ai_engine_mcts" : "ai_engine_alpha_beta"));
 		int choice = mInputHandler.GetMenuChoice(selectedOption, numMenuOptions);
 		if (choice > 0) {
 			selectedOption = choice;
@@ -106,8 +106,9 @@ void GameManager::ShowMainMenu() {
 			case 1: mCurrentGameMode = GameMode::PLAYER_VS_PLAYER; gameModeSelected = true; break;
 			case 2: mCurrentGameMode = GameMode::PLAYER_VS_COMPUTER; gameModeSelected = true; break;
 			case 3: mCurrentGameMode = GameMode::COMPUTER_VS_COMPUTER; gameModeSelected = true; break;
-			case 4: ShowGlobalStats(); break;
-			case 5: exitMenu = true; break;
+			case 4: mAiEngine = (mAiEngine == AiEngine::MCTS) ? AiEngine::ALPHA_BETA : AiEngine::MCTS; break;
+			case 5: ShowGlobalStats(); break;
+			case 6: exitMenu = true; break;
 			}
 			if (gameModeSelected) {
 				mView.SetGameColorsAndClear();
@@ -132,20 +133,17 @@ void GameManager::ShowGlobalStats() {
 
 // Inicia una nueva partida, reseteando el tablero y el estado del juego segun el modo seleccionado
 void GameManager::StartNewGame() {
-	mGameBoard.InitializeBoard();
-	mCurrentPlayerTurnColor = PlayerColor::PLAYER_1;
-	mIsGameOver = false; mGameStats = GameStats{}; mLastMove = Move{};
-	mInCaptureSequence = false; mForcedPieceRow = -1; mForcedPieceCol = -1;
+	mEngine.NewGame();
 	switch (mCurrentGameMode) {
 	case GameMode::PLAYER_VS_PLAYER:
 		m_player1 = std::make_unique<HumanPlayer>(PlayerColor::PLAYER_1, mInputHandler, mView);
 		m_player2 = std::make_unique<HumanPlayer>(PlayerColor::PLAYER_2, mInputHandler, mView); break;
 	case GameMode::PLAYER_VS_COMPUTER:
 		m_player1 = std::make_unique<HumanPlayer>(PlayerColor::PLAYER_1, mInputHandler, mView);
-		m_player2 = std::make_unique<ComputerPlayer>(PlayerColor::PLAYER_2, mMoveGenerator); break;
+		m_player2 = CreateComputerPlayer(PlayerColor::PLAYER_2); break;
 	case GameMode::COMPUTER_VS_COMPUTER:
-		m_player1 = std::make_unique<ComputerPlayer>(PlayerColor::PLAYER_1, mMoveGenerator);
-		m_player2 = std::make_unique<ComputerPlayer>(PlayerColor::PLAYER_2, mMoveGenerator); break;
+		m_player1 = CreateComputerPlayer(PlayerColor::PLAYER_1);
+		m_player2 = CreateComputerPlayer(PlayerColor::PLAYER_2); break;
 	default:
 		mView.DisplayMessage(m_i18n.GetString("error_invalid_mode"), true, CONSOLE_COLOR_RED, CONSOLE_COLOR_BLACK);
 		if (std::cin.peek() == '\n') std::cin.ignore();
@@ -157,6 +155,22 @@ void GameManager::StartNewGame() {
 	m_currentPlayerObject = m_player1.get();
 }
 
+// Crea un jugador IA con la dificultad por defecto y el motor elegido en el menu.
+// La busqueda alfa-beta consulta las tablas de finales y el libro si estan cargados.
+std::unique_ptr<Player> GameManager::CreateComputerPlayer(PlayerColor color) {
+	if (mAiEngine == AiEngine::MCTS) {
+		return std::make_unique<MctsComputerPlayer>(color, mEngine.GetMoveGenerator());
+	}
+	std::unique_ptr<ComputerPlayer> player = std::make_unique<ComputerPlayer>(color, mEngine.GetMoveGenerator());
+	if (mTablebase.IsLoaded()) {
+		player->SetEndgameTablebase(&mTablebase);
+	}
+	if (mOpeningBook.IsLoaded()) {
+		player->SetOpeningBook(&mOpeningBook);
+	}
+	return player;
+}
+
 // Ejecuta el bucle principal del juego, mostrando el titulo, reglas y procesando turnos hasta que el juego termine
 void GameManager::RunGameLoop() {
 	if (mCurrentGameMode == GameMode::NONE || !m_player1 || !m_player2) {
@@ -173,8 +187,7 @@ void GameManager::RunGameLoop() {
 	mView.DisplayMessage(m_i18n.GetString("game_rules_line1"), true, CONSOLE_COLOR_LIGHT_GRAY, CONSOLE_COLOR_BLACK);
 	mView.DisplayMessage(m_i18n.GetString("game_rules_line2"), true, CONSOLE_COLOR_LIGHT_GRAY, CONSOLE_COLOR_BLACK);
 	mView.DisplayMessage("--------------------------------------------------", true, CONSOLE_COLOR_WHITE, CONSOLE_COLOR_BLACK);
-	mIsGameOver = false;
-	while (!mIsGameOver) { ProcessPlayerTurn(); } AnnounceResult();
+	while (!mEngine.IsOver()) { ProcessPlayerTurn(); } AnnounceResult();
 }
 
 // Muestra las estadisticas actuales de la partida en la consola
@@ -182,11 +195,13 @@ void GameManager::DisplayCurrentStats() {
 	int statsY = GAME_TITLE_LINES + BOARD_VISUAL_HEIGHT + 7;
 	GoToXY(0, statsY); mView.ClearLines(statsY, 6, CONSOLE_WIDTH_ASSUMED); GoToXY(0, statsY);
 	mView.DisplayMessage(m_i18n.GetString("game_current_stats_title"), true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
-	mView.DisplayMessage(m_i18n.GetString("game_current_turn") + std::to_string(mGameStats.currentTurnNumber), true, CONSOLE_COLOR_LIGHT_GRAY, CONSOLE_COLOR_BLACK);
-	int p1p = mGameBoard.GetPieceCount(PlayerColor::PLAYER_1), p1k = mGameBoard.GetKingCount(PlayerColor::PLAYER_1), p1m = p1p - p1k;
-	int p2p = mGameBoard.GetPieceCount(PlayerColor::PLAYER_2), p2k = mGameBoard.GetKingCount(PlayerColor::PLAYER_2), p2m = p2p - p2k;
-	mView.DisplayMessage(PlayerColorToString(PlayerColor::PLAYER_1, m_i18n) + ": " + std::to_string(p1p) + " (" + std::to_string(p1m) + "p, " + std::to_string(p1k) + "D). Capt: " + std::to_string(mGameStats.player1CapturedCount), true, CONSOLE_COLOR_LIGHT_GRAY, CONSOLE_COLOR_BLACK);
-	mView.DisplayMessage(PlayerColorToString(PlayerColor::PLAYER_2, m_i18n) + ": " + std::to_string(p2p) + " (" + std::to_string(p2m) + "p, " + std::to_string(p2k) + "D). Capt: " + std::to_string(mGameStats.player2CapturedCount), true, CONSOLE_COLOR_LIGHT_GRAY, CONSOLE_COLOR_BLACK);
+	const Board& gameBoard = mEngine.GetBoard();
+	const GameStats& gameStats = mEngine.GetStats();
+	mView.DisplayMessage(m_i18n.GetString("game_current_turn") + std::to_string(gameStats.currentTurnNumber), true, CONSOLE_COLOR_LIGHT_GRAY, CONSOLE_COLOR_BLACK);
+	int p1p = gameBoard.GetPieceCount(PlayerColor::PLAYER_1), p1k = gameBoard.GetKingCount(PlayerColor::PLAYER_1), p1m = p1p - p1k;
+	int p2p = gameBoard.GetPieceCount(PlayerColor::PLAYER_2), p2k = gameBoard.GetKingCount(PlayerColor::PLAYER_2), p2m = p2p - p2k;
+	mView.DisplayMessage(PlayerColorToString(PlayerColor::PLAYER_1, m_i18n) + ": " + std::to_string(p1p) + " (" + std::to_string(p1m) + "p, " + std::to_string(p1k) + "D). Capt: " + std::to_string(gameStats.player1CapturedCount), true, CONSOLE_COLOR_LIGHT_GRAY, CONSOLE_COLOR_BLACK);
+	mView.DisplayMessage(PlayerColorToString(PlayerColor::PLAYER_2, m_i18n) + ": " + std::to_string(p2p) + " (" + std::to_string(p2m) + "p, " + std::to_string(p2k) + "D). Capt: " + std::to_string(gameStats.player2CapturedCount), true, CONSOLE_COLOR_LIGHT_GRAY, CONSOLE_COLOR_BLACK);
 	mView.DisplayMessage("-----------------------------", true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
 }
 
@@ -194,43 +209,36 @@ void GameManager::DisplayCurrentStats() {
 void GameManager::DisplayLastMove() {
 	int lastMoveY = GAME_TITLE_LINES + BOARD_VISUAL_HEIGHT;
 	GoToXY(0, lastMoveY); mView.ClearLines(lastMoveY, 1, CONSOLE_WIDTH_ASSUMED); GoToXY(0, lastMoveY);
-	if (!mLastMove.IsNull()) { mView.DisplayMessage(m_i18n.GetString("last_move") + mLastMove.ToNotation(m_i18n), true, CONSOLE_COLOR_WHITE, CONSOLE_COLOR_BLACK); }
+	const Move& lastMove = mEngine.GetLastMove();
+	if (!lastMove.IsNull()) { mView.DisplayMessage(m_i18n.GetString("last_move") + lastMove.ToNotation(m_i18n), true, CONSOLE_COLOR_WHITE, CONSOLE_COLOR_BLACK); }
 }
 
 // Procesa el turno del jugador actual, incluyendo entrada de movimiento y validacion
 void GameManager::ProcessPlayerTurn() {
 	bool turnActionSuccessfullyCompleted = false;
-	while (!turnActionSuccessfullyCompleted && !mIsGameOver) {
+	while (!turnActionSuccessfullyCompleted && !mEngine.IsOver()) {
 		GoToXY(0, GAME_TITLE_LINES); mView.ClearLines(GAME_TITLE_LINES, BOARD_VISUAL_HEIGHT + 15, CONSOLE_WIDTH_ASSUMED); GoToXY(0, GAME_TITLE_LINES);
-		mView.DisplayBoard(mGameBoard, CONSOLE_COLOR_BLACK); DisplayLastMove();
+		mView.DisplayBoard(mEngine.GetBoard(), CONSOLE_COLOR_BLACK); DisplayLastMove();
 		int turnMessageY = GAME_TITLE_LINES + BOARD_VISUAL_HEIGHT + 1; GoToXY(0, turnMessageY);
-		std::vector<Move> mandatoryJumpsForCurrentPlayer;
-		MandatoryActionType currentMandatoryAction = MandatoryActionType::NONE;
-
-		if (!mInCaptureSequence) {
-			currentMandatoryAction = mMoveGenerator.GetMandatoryActionType(mGameBoard, mCurrentPlayerTurnColor, mandatoryJumpsForCurrentPlayer);
-		}
-		else {
-			mandatoryJumpsForCurrentPlayer = mMoveGenerator.GetPossibleJumpsForSpecificPiece(mGameBoard, mForcedPieceRow, mForcedPieceCol);
-			PieceType forcedPiece = mGameBoard.GetPieceAt(mForcedPieceRow, mForcedPieceCol);
-			currentMandatoryAction = (forcedPiece == PieceType::P1_KING || forcedPiece == PieceType::P2_KING) ? MandatoryActionType::KING_CAPTURE : MandatoryActionType::PAWN_CAPTURE;
-		}
-
-		if (!mInCaptureSequence && !mMoveGenerator.HasAnyValidMoves(mGameBoard, mCurrentPlayerTurnColor)) {
-			mView.DisplayMessage(m_i18n.GetString("player_mention") + PlayerColorToString(mCurrentPlayerTurnColor, m_i18n) + m_i18n.GetString("reason_no_moves"), true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
-			mGameStats.winner = (mCurrentPlayerTurnColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
-			mGameStats.reason = GameOverReason::NO_MOVES; mIsGameOver = true; turnActionSuccessfullyCompleted = true; continue;
+		const Board& gameBoard = mEngine.GetBoard();
+		PlayerColor currentPlayerColor = mEngine.GetCurrentPlayer();
+		MoveList mandatoryJumpsForCurrentPlayer;
+		MandatoryActionType currentMandatoryAction = mEngine.GetMandatoryMoves(mandatoryJumpsForCurrentPlayer);
+
+		if (!mEngine.CheckCurrentPlayerCanMove()) {
+			mView.DisplayMessage(m_i18n.GetString("player_mention") + PlayerColorToString(currentPlayerColor, m_i18n) + m_i18n.GetString("reason_no_moves"), true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
+			turnActionSuccessfullyCompleted = true; continue;
 		}
-		std::string turnMsg = m_i18n.GetString("turn_of_player") + PlayerColorToString(mCurrentPlayerTurnColor, m_i18n) + ". ";
-		if (mInCaptureSequence) { turnMsg += m_i18n.GetString("turn_continue_capture") + ToAlgebraic(mForcedPieceRow, mForcedPieceCol) + "."; }
+		std::string turnMsg = m_i18n.GetString("turn_of_player") + PlayerColorToString(currentPlayerColor, m_i18n) + ". ";
+		if (mEngine.IsInCaptureSequence()) { turnMsg += m_i18n.GetString("turn_continue_capture") + ToAlgebraic(mEngine.GetForcedPieceRow(), mEngine.GetForcedPieceCol()) + "."; }
 		mView.DisplayMessage(turnMsg, true, CONSOLE_COLOR_LIGHT_CYAN, CONSOLE_COLOR_BLACK);
 
 		// --- INICIO MODIFICACIÓN PAUSA CvC ---
-		if (mCurrentGameMode == GameMode::COMPUTER_VS_COMPUTER && dynamic_cast<ComputerPlayer*>(m_currentPlayerObject)) {
+		if (mCurrentGameMode == GameMode::COMPUTER_VS_COMPUTER && !dynamic_cast<HumanPlayer*>(m_currentPlayerObject)) {
 			GoToXY(0, turnMessageY + 1);
 			mView.ClearLines(turnMessageY + 1, 2, CONSOLE_WIDTH_ASSUMED); // Limpiar para mensaje y prompt
 			GoToXY(0, turnMessageY + 1);
-			mView.DisplayMessage(m_i18n.GetString("artificial_inteligence") + "(" + PlayerColorToString(mCurrentPlayerTurnColor, m_i18n) + ")" + m_i18n.GetString("cvc_ia_turn_prompt"), false, CONSOLE_COLOR_DARK_GRAY, CONSOLE_COLOR_BLACK);
+			mView.DisplayMessage(m_i18n.GetString("artificial_inteligence") + "(" + PlayerColorToString(currentPlayerColor, m_i18n) + ")" + m_i18n.GetString("cvc_ia_turn_prompt"), false, CONSOLE_COLOR_DARK_GRAY, CONSOLE_COLOR_BLACK);
 			std::cout << std::endl << "> "; // Mover el prompt ">" a la siguiente línea
 
 			std::string cvc_command_line;
@@ -244,9 +252,7 @@ void GameManager::ProcessPlayerTurn() {
 
 			if (command_lower == "salir" || command_lower == "exit") {
 				mView.DisplayMessage(m_i18n.GetString("cvc_observer_exit"), true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
-				mIsGameOver = true;
-				mGameStats.reason = GameOverReason::PLAYER_EXIT;
-				mGameStats.winner = PlayerColor::NONE;
+				mEngine.EndGame(PlayerColor::NONE, GameOverReason::PLAYER_EXIT);
 				turnActionSuccessfullyCompleted = true;
 				continue; // Salir del bucle while de ProcessPlayerTurn
 			}
@@ -267,21 +273,27 @@ void GameManager::ProcessPlayerTurn() {
 			GoToXY(0, turnMessageY + 1); // Reposicionar por si acaso
 		}
 
-		if (!m_currentPlayerObject) { mView.DisplayMessage(m_i18n.GetString("critical_error_player_undefinedt"), true, CONSOLE_COLOR_RED, CONSOLE_COLOR_BLACK); mIsGameOver = true; continue; }
-		MoveInput userInput = m_currentPlayerObject->GetChosenMoveInput(mGameBoard, mMoveGenerator, mInCaptureSequence, mForcedPieceRow, mForcedPieceCol, mandatoryJumpsForCurrentPlayer);
+		if (!m_currentPlayerObject) { mView.DisplayMessage(m_i18n.GetString("critical_error_player_undefinedt"), true, CONSOLE_COLOR_RED, CONSOLE_COLOR_BLACK); mEngine.EndGame(PlayerColor::NONE, GameOverReason::NONE); continue; }
+		// Solo la IA necesita los movimientos completos del turno (el motor los genera al pedirlos)
+		MoveInput userInput;
+		if (AiPlayer* aiPlayer = dynamic_cast<AiPlayer*>(m_currentPlayerObject)) {
+			userInput = aiPlayer->GetChosenMoveInput(gameBoard, mEngine.GetMoveGenerator(), mEngine.IsInCaptureSequence(), mEngine.GetForcedPieceRow(), mEngine.GetForcedPieceCol(), mEngine.GetLegalMoveSequences());
+		}
+		else {
+			userInput = m_currentPlayerObject->GetChosenMoveInput(gameBoard, mEngine.GetMoveGenerator(), mEngine.IsInCaptureSequence(), mEngine.GetForcedPieceRow(), mEngine.GetForcedPieceCol());
+		}
 
 		int feedbackY = turnMessageY + 2;
 		// Ajustar feedbackY si estábamos en pausa de CvC
-		if (mCurrentGameMode == GameMode::COMPUTER_VS_COMPUTER && dynamic_cast<ComputerPlayer*>(m_currentPlayerObject)) {
+		if (mCurrentGameMode == GameMode::COMPUTER_VS_COMPUTER && !dynamic_cast<HumanPlayer*>(m_currentPlayerObject)) {
 			feedbackY = turnMessageY + 1; 
 		}
 		GoToXY(0, feedbackY); mView.ClearLines(feedbackY, 8, CONSOLE_WIDTH_ASSUMED); GoToXY(0, feedbackY);
 
 		if (userInput.wantsToExit) {
-			mView.DisplayMessage(m_i18n.GetString("player_mention") + PlayerColorToString(mCurrentPlayerTurnColor, m_i18n) + m_i18n.GetString("player_wants_to_exit"), true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
-			mIsGameOver = true; mGameStats.reason = GameOverReason::PLAYER_EXIT;
-			mGameStats.winner = (mCurrentPlayerTurnColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
-			turnActionSuccessfullyCompleted = true; mInCaptureSequence = false;
+			mView.DisplayMessage(m_i18n.GetString("player_mention") + PlayerColorToString(currentPlayerColor, m_i18n) + m_i18n.GetString("player_wants_to_exit"), true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
+			mEngine.EndGame((currentPlayerColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1, GameOverReason::PLAYER_EXIT);
+			turnActionSuccessfullyCompleted = true;
 		}
 		else if (userInput.wantsToShowStats && dynamic_cast<HumanPlayer*>(m_currentPlayerObject)) {
 			DisplayCurrentStats(); int pressY = (GAME_TITLE_LINES + BOARD_VISUAL_HEIGHT + 7) + 6; GoToXY(0, pressY);
@@ -296,105 +308,84 @@ void GameManager::ProcessPlayerTurn() {
 				if (std::cin.peek() == '\n') std::cin.ignore(); std::cin.ignore((std::numeric_limits<std::streamsize>::max)(), '\n');
 			}
 			else {
-				mView.DisplayMessage(m_i18n.GetString("artificial_inteligence") + "(" + PlayerColorToString(mCurrentPlayerTurnColor, m_i18n) + ")"+ m_i18n.GetString("error_ai_no_move"), true, CONSOLE_COLOR_RED, CONSOLE_COLOR_BLACK);
-				mGameStats.winner = (mCurrentPlayerTurnColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
-				mGameStats.reason = GameOverReason::NO_MOVES; mIsGameOver = true; turnActionSuccessfullyCompleted = true;
+				mView.DisplayMessage(m_i18n.GetString("artificial_inteligence") + "(" + PlayerColorToString(currentPlayerColor, m_i18n) + ")"+ m_i18n.GetString("error_ai_no_move"), true, CONSOLE_COLOR_RED, CONSOLE_COLOR_BLACK);
+				mEngine.EndGame((currentPlayerColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1, GameOverReason::NO_MOVES);
+				turnActionSuccessfullyCompleted = true;
 			}
 		}
 		else {
 			int sR = userInput.startRow, sC = userInput.startCol, eR = userInput.endRow, eC = userInput.endCol;
-			bool moveWasCapture = false;
 			std::string specificErrorMessage = ""; // Para mensajes de error más detallados
-			bool isValidAttemptGeneral = true;     // Para controlar el flujo de validación
+			PieceType attemptedMovePieceType = gameBoard.GetPieceAt(sR, sC);
+			// El motor valida y aplica el movimiento; aqui solo se traduce el resultado a mensajes
+			MoveResult moveResult = mEngine.ApplyMove(sR, sC, eR, eC);
+			bool isValidAttemptGeneral = (moveResult == MoveResult::APPLIED);
 
-			if (mInCaptureSequence) {
-				
-				if (sR != mForcedPieceRow || sC != mForcedPieceCol) {
-					specificErrorMessage = m_i18n.GetString("error_must_move_forced_piece1") + ToAlgebraic(mForcedPieceRow, mForcedPieceCol) + m_i18n.GetString("error_must_move_forced_piece2");
-					isValidAttemptGeneral = false;
+			if (moveResult == MoveResult::NOT_FORCED_PIECE) {
+				specificErrorMessage = m_i18n.GetString("error_must_move_forced_piece1") + ToAlgebraic(mEngine.GetForcedPieceRow(), mEngine.GetForcedPieceCol()) + m_i18n.GetString("error_must_move_forced_piece2");
+			}
+			else if (moveResult == MoveResult::INVALID_CONTINUATION) {
+				specificErrorMessage = m_i18n.GetString("error_invalid_jump_sequence1") + ToAlgebraic(mEngine.GetForcedPieceRow(), mEngine.GetForcedPieceCol()) +
+					m_i18n.GetString("error_invalid_jump_sequence2") + ToAlgebraic(eR, eC) + m_i18n.GetString("error_invalid_jump_sequence1") + "\n";
+				specificErrorMessage += m_i18n.GetString("error_invalid_jump_sequence4");
+				if (mandatoryJumpsForCurrentPlayer.empty()) {
+					specificErrorMessage += m_i18n.GetString("error_no_jumps_left_sequence");
 				}
 				else {
-					bool isValidContinuationJump = false;
-					for (const auto& jump : mandatoryJumpsForCurrentPlayer) {
-						if (jump.endR_ == eR && jump.endC_ == eC) {
-							isValidContinuationJump = true;
-							moveWasCapture = true; // Un salto de continuación siempre es captura
-							break;
-						}
-					}
-					if (!isValidContinuationJump) {
-						specificErrorMessage = m_i18n.GetString("error_invalid_jump_sequence1") + ToAlgebraic(mForcedPieceRow, mForcedPieceCol) +
-							m_i18n.GetString("error_invalid_jump_sequence2") + ToAlgebraic(eR, eC) + m_i18n.GetString("error_invalid_jump_sequence1") + "\n";
-						specificErrorMessage += m_i18n.GetString("error_invalid_jump_sequence4");
-						if (mandatoryJumpsForCurrentPlayer.empty()) {
-							specificErrorMessage += m_i18n.GetString("error_no_jumps_left_sequence");
-							mInCaptureSequence = false;
-						}
-						else {
-							for (size_t i = 0; i < mandatoryJumpsForCurrentPlayer.size(); ++i) {
-								specificErrorMessage += ToAlgebraic(mandatoryJumpsForCurrentPlayer[i].endR_, mandatoryJumpsForCurrentPlayer[i].endC_) + (i == mandatoryJumpsForCurrentPlayer.size() - 1 ? "" : ", ");
-							}
-						}
-						isValidAttemptGeneral = false;
+					for (size_t i = 0; i < mandatoryJumpsForCurrentPlayer.size(); ++i) {
+						specificErrorMessage += ToAlgebraic(mandatoryJumpsForCurrentPlayer[i].endR_, mandatoryJumpsForCurrentPlayer[i].endC_) + (i == mandatoryJumpsForCurrentPlayer.size() - 1 ? "" : ", ");
 					}
 				}
 			}
-			else {
-				// (Lógica de validación de movimiento normal, usando currentMandatoryAction y mandatoryJumpsForCurrentPlayer
-				
-				if (!mMoveGenerator.IsValidMove(mGameBoard, sR, sC, eR, eC, mCurrentPlayerTurnColor, moveWasCapture)) {
-					isValidAttemptGeneral = false;
-					PieceType attemptedMovePieceType = mGameBoard.GetPieceAt(sR, sC);
-
-					if (currentMandatoryAction == MandatoryActionType::KING_CAPTURE) {
-						specificErrorMessage = m_i18n.GetString("error_must_capture_king1") + "\n";
-						if (!mandatoryJumpsForCurrentPlayer.empty()) {
-							specificErrorMessage += m_i18n.GetString("error_must_capture_king2") + "\n";
-							for (const auto& jump_move : mandatoryJumpsForCurrentPlayer) {
-								specificErrorMessage += "  -> " + jump_move.ToNotation(m_i18n) + "\n";
-							}
-						}
-						else {
-							specificErrorMessage += m_i18n.GetString("error_internal_no_mandatory_moves") + "\n";
+			else if (moveResult == MoveResult::ILLEGAL_MOVE) {
+				if (currentMandatoryAction == MandatoryActionType::KING_CAPTURE) {
+					specificErrorMessage = m_i18n.GetString("error_must_capture_king1") + "\n";
+					if (!mandatoryJumpsForCurrentPlayer.empty()) {
+						specificErrorMessage += m_i18n.GetString("error_must_capture_king2") + "\n";
+						for (const auto& jump_move : mandatoryJumpsForCurrentPlayer) {
+							specificErrorMessage += "  -> " + jump_move.ToNotation(m_i18n) + "\n";
 						}
 					}
-					else if (currentMandatoryAction == MandatoryActionType::PAWN_CAPTURE) {
-						if (attemptedMovePieceType == PieceType::P1_KING || attemptedMovePieceType == PieceType::P2_KING) {
-							specificErrorMessage = m_i18n.GetString("error_king_move_when_pawn_capture1") + "\n";
-							specificErrorMessage += m_i18n.GetString("error_king_move_when_pawn_capture2") + "\n";
-						}
-						else {
-							specificErrorMessage += m_i18n.GetString("error_must_capture_pawn1") + "\n";
-						}
-						if (!mandatoryJumpsForCurrentPlayer.empty()) {
-							specificErrorMessage += m_i18n.GetString("error_must_capture_pawn2") + "\n";
+					else {
+						specificErrorMessage += m_i18n.GetString("error_internal_no_mandatory_moves") + "\n";
+					}
+				}
+				else if (currentMandatoryAction == MandatoryActionType::PAWN_CAPTURE) {
+					if (attemptedMovePieceType == PieceType::P1_KING || attemptedMovePieceType == PieceType::P2_KING) {
+						specificErrorMessage = m_i18n.GetString("error_king_move_when_pawn_capture1") + "\n";
+						specificErrorMessage += m_i18n.GetString("error_king_move_when_pawn_capture2") + "\n";
+					}
+					else {
+						specificErrorMessage += m_i18n.GetString("error_must_capture_pawn1") + "\n";
+					}
+					if (!mandatoryJumpsForCurrentPlayer.empty()) {
+						specificErrorMessage += m_i18n.GetString("error_must_capture_pawn2") + "\n";
 
-							for (const auto& jump_move : mandatoryJumpsForCurrentPlayer) {
-								specificErrorMessage += "  -> " + jump_move.ToNotation(m_i18n) + "\n";
-							}
-						}
-						else {
-							specificErrorMessage += m_i18n.GetString("error_internal_no_mandatory_moves") + "\n";
+						for (const auto& jump_move : mandatoryJumpsForCurrentPlayer) {
+							specificErrorMessage += "  -> " + jump_move.ToNotation(m_i18n) + "\n";
 						}
 					}
-					else if (currentMandatoryAction == MandatoryActionType::NONE) {
-						bool proposedMoveWasIntendedAsCapture = (std::abs(sR - eR) == 2 && std::abs(sC - eC) == 2);
-						if (proposedMoveWasIntendedAsCapture) {
-							specificErrorMessage = m_i18n.GetString("error_no_mandatory_capture_attempt");
-						}
-						else if (mGameBoard.GetPieceAt(eR, eC) != PieceType::EMPTY) {
-							specificErrorMessage = m_i18n.GetString("error_destination_occupied1") + "(" + ToAlgebraic(eR, eC) + ") " + m_i18n.GetString("error_destination_occupied2");
-						}
-						else {
-							specificErrorMessage = m_i18n.GetString("error_move_not_legal1") +
-								ToAlgebraic(sR, sC) + m_i18n.GetString("error_move_not_legal2") +
-								ToAlgebraic(eR, eC) + m_i18n.GetString("error_move_not_legal3");
-						}
+					else {
+						specificErrorMessage += m_i18n.GetString("error_internal_no_mandatory_moves") + "\n";
+					}
+				}
+				else if (currentMandatoryAction == MandatoryActionType::NONE) {
+					bool proposedMoveWasIntendedAsCapture = (std::abs(sR - eR) == 2 && std::abs(sC - eC) == 2);
+					if (proposedMoveWasIntendedAsCapture) {
+						specificErrorMessage = m_i18n.GetString("error_no_mandatory_capture_attempt");
+					}
+					else if (gameBoard.GetPieceAt(eR, eC) != PieceType::EMPTY) {
+						specificErrorMessage = m_i18n.GetString("error_destination_occupied1") + "(" + ToAlgebraic(eR, eC) + ") " + m_i18n.GetString("error_destination_occupied2");
 					}
 					else {
-						specificErrorMessage = m_i18n.GetString("error_unknown_move_rule");
+						specificErrorMessage = m_i18n.GetString("error_move_not_legal1") +
+							ToAlgebraic(sR, sC) + m_i18n.GetString("error_move_not_legal2") +
+							ToAlgebraic(eR, eC) + m_i18n.GetString("error_move_not_legal3");
 					}
 				}
+				else {
+					specificErrorMessage = m_i18n.GetString("error_unknown_move_rule");
+				}
 			}
 
 
@@ -411,78 +402,43 @@ void GameManager::ProcessPlayerTurn() {
 				continue; // Vuelve al inicio del bucle ProcessPlayerTurn
 			}
 
-			// Si llegamos aquí, el movimiento es válido.
-			Move currentMove;
-			currentMove.startR_ = sR; currentMove.startC_ = sC; currentMove.endR_ = eR; currentMove.endC_ = eC;
-			currentMove.pieceMoved_ = mGameBoard.GetPieceAt(sR, sC);
-			currentMove.playerColor_ = mCurrentPlayerTurnColor;
-			currentMove.isCapture_ = moveWasCapture;
-
-			PieceType pieceToMove = mGameBoard.GetPieceAt(sR, sC);
-			mGameBoard.SetPieceAt(eR, eC, pieceToMove);
-			mGameBoard.SetPieceAt(sR, sC, PieceType::EMPTY);
-
-			if (moveWasCapture) {
-				int capturedRow = sR + (eR - sR) / 2;
-				int capturedCol = sC + (eC - sC) / 2;
-				mGameBoard.SetPieceAt(capturedRow, capturedCol, PieceType::EMPTY);
-				if (mCurrentPlayerTurnColor == PlayerColor::PLAYER_1) mGameStats.player1CapturedCount++;
-				else mGameStats.player2CapturedCount++;
-			}
-			mGameBoard.PromotePieceIfNecessary(eR, eC);
+			// Si llegamos aquí, el movimiento es válido y ya se aplicó.
+			const Move& currentMove = mEngine.GetLastMove();
 
 			// Mensaje de movimiento realizado
-			if (mCurrentGameMode != GameMode::COMPUTER_VS_COMPUTER || !dynamic_cast<ComputerPlayer*>(m_currentPlayerObject)) {
+			if (mCurrentGameMode != GameMode::COMPUTER_VS_COMPUTER || dynamic_cast<HumanPlayer*>(m_currentPlayerObject)) {
 				mView.DisplayMessage(m_i18n.GetString("move_successful") + currentMove.ToNotation(m_i18n), true, CONSOLE_COLOR_LIGHT_GREEN, CONSOLE_COLOR_BLACK);
 			}
 			else {
-				mView.DisplayMessage(m_i18n.GetString("artificial_inteligence") + " (" + PlayerColorToString(mCurrentPlayerTurnColor, m_i18n) + ") "+ m_i18n.GetString("done") + currentMove.ToNotation(m_i18n), true, CONSOLE_COLOR_CYAN, CONSOLE_COLOR_BLACK);
+				mView.DisplayMessage(m_i18n.GetString("artificial_inteligence") + " (" + PlayerColorToString(currentPlayerColor, m_i18n) + ") "+ m_i18n.GetString("done") + currentMove.ToNotation(m_i18n), true, CONSOLE_COLOR_CYAN, CONSOLE_COLOR_BLACK);
 				// No hay pausa de thread aquí, la pausa de CvC es ANTES de obtener el movimiento.
 			}
-			mLastMove = currentMove;
 
-
-			if (moveWasCapture) {
-				std::vector<Move> furtherJumps = mMoveGenerator.GetPossibleJumpsForSpecificPiece(mGameBoard, eR, eC);
-				if (!furtherJumps.empty()) {
-					mInCaptureSequence = true; mForcedPieceRow = eR; mForcedPieceCol = eC;
-					if (dynamic_cast<HumanPlayer*>(m_currentPlayerObject) && std::cin.rdbuf()->in_avail() > 0) { std::cin.ignore((std::numeric_limits<std::streamsize>::max)(), '\n'); }
-				}
-				else { mInCaptureSequence = false; turnActionSuccessfullyCompleted = true; }
+			if (mEngine.IsInCaptureSequence()) {
+				if (dynamic_cast<HumanPlayer*>(m_currentPlayerObject) && std::cin.rdbuf()->in_avail() > 0) { std::cin.ignore((std::numeric_limits<std::streamsize>::max)(), '\n'); }
 			}
-			else { mInCaptureSequence = false; turnActionSuccessfullyCompleted = true; }
-
-			if (turnActionSuccessfullyCompleted) {
-				PlayerColor opponent = (mCurrentPlayerTurnColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
-				if (mGameBoard.GetPieceCount(opponent) == 0) {
+			else {
+				turnActionSuccessfullyCompleted = true;
+				PlayerColor opponent = (currentPlayerColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+				if (mEngine.IsOver() && mEngine.GetStats().reason == GameOverReason::NO_PIECES) {
 					mView.DisplayMessage(m_i18n.GetString("game_over_no_pieces_opponent"), true, CONSOLE_COLOR_LIGHT_GREEN, CONSOLE_COLOR_BLACK);
-					mGameStats.winner = mCurrentPlayerTurnColor; mGameStats.reason = GameOverReason::NO_PIECES; mIsGameOver = true;
 				}
-				else if (!mIsGameOver) {
-					// Verificar si el oponente tiene movimientos ANTES de cambiar de jugador
-					// Pero solo si el juego no ha terminado ya por otra razón.
-					if (!mMoveGenerator.HasAnyValidMoves(mGameBoard, opponent)) {
-						mView.DisplayMessage(m_i18n.GetString("game_over_no_pieces_opponent"), true, CONSOLE_COLOR_LIGHT_GREEN, CONSOLE_COLOR_BLACK);
-						mView.DisplayMessage(m_i18n.GetString("player_mention") + PlayerColorToString(opponent, m_i18n) + m_i18n.GetString("reason_no_moves"), true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
-						mGameStats.winner = mCurrentPlayerTurnColor; // Gana el jugador actual
-						mGameStats.reason = GameOverReason::NO_MOVES;
-						mIsGameOver = true;
-					}
-					else {
-						// Solo incrementar turno y cambiar jugador si el juego no ha terminado
-						mGameStats.currentTurnNumber++;
-						SwitchPlayer();
-					}
+				else if (mEngine.IsOver() && mEngine.GetStats().reason == GameOverReason::NO_MOVES) {
+					mView.DisplayMessage(m_i18n.GetString("game_over_no_pieces_opponent"), true, CONSOLE_COLOR_LIGHT_GREEN, CONSOLE_COLOR_BLACK);
+					mView.DisplayMessage(m_i18n.GetString("player_mention") + PlayerColorToString(opponent, m_i18n) + m_i18n.GetString("reason_no_moves"), true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
+				}
+				else {
+					// El motor ya paso el turno al oponente
+					SyncCurrentPlayerObject();
 				}
 			}
 		}
 	}
 }
-void GameManager::SwitchPlayer() {
-	if (!mIsGameOver) {
-		mCurrentPlayerTurnColor = (mCurrentPlayerTurnColor == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
-		m_currentPlayerObject = (mCurrentPlayerTurnColor == PlayerColor::PLAYER_1) ? m_player1.get() : m_player2.get();
-	}
+
+// Apunta m_currentPlayerObject al jugador que tiene el turno segun el motor
+void GameManager::SyncCurrentPlayerObject() {
+	m_currentPlayerObject = (mEngine.GetCurrentPlayer() == PlayerColor::PLAYER_1) ? m_player1.get() : m_player2.get();
 }
 
 // Anuncia el resultado final de la partida y muestra las estadisticas
@@ -490,6 +446,7 @@ void GameManager::AnnounceResult() {
 	int finalMessageStartY = GAME_TITLE_LINES; GoToXY(0, finalMessageStartY);
 	mView.ClearLines(finalMessageStartY, BOARD_VISUAL_HEIGHT + 20, CONSOLE_WIDTH_ASSUMED); GoToXY(0, finalMessageStartY);
 	mView.DisplayMessage(m_i18n.GetString("announce_game_over_title"), true, CONSOLE_COLOR_YELLOW, CONSOLE_COLOR_BLACK);
+	const GameStats& gameStats = mEngine.GetStats();
 	GameResult gameResultData; // Asumo que GameResult está definido en CommonTypes.h o FileHandler.h
 	gameResultData.date = getCurrentDateTime("%Y-%m-%d"); gameResultData.time = getCurrentDateTime("%H:%M:%S");
 	std::string p1TypeStr = m_i18n.GetString("unknown"), p2TypeStr = m_i18n.GetString("unknown");
@@ -505,10 +462,10 @@ void GameManager::AnnounceResult() {
 	}
 	gameResultData.playerTypes = p1TypeStr + " vs " + p2TypeStr;
 
-	PlayerColor winner = mGameStats.winner;
+	PlayerColor winner = gameStats.winner;
 	if (winner != PlayerColor::NONE) gameResultData.winner = PlayerColorToString(winner, m_i18n);
-	else if (mGameStats.reason == GameOverReason::STALEMATE_BY_RULES) gameResultData.winner = m_i18n.GetString("announce_draw");
-	else if (mGameStats.reason == GameOverReason::PLAYER_EXIT && mCurrentGameMode == GameMode::COMPUTER_VS_COMPUTER) gameResultData.winner = "N/A";
+	else if (gameStats.reason == GameOverReason::STALEMATE_BY_RULES) gameResultData.winner = m_i18n.GetString("announce_draw");
+	else if (gameStats.reason == GameOverReason::PLAYER_EXIT && mCurrentGameMode == GameMode::COMPUTER_VS_COMPUTER) gameResultData.winner = "N/A";
 	else gameResultData.winner = "N/A"; // O "Indeterminado"
 
 	std::string reasonDisplayStr = "";
@@ -517,7 +474,7 @@ void GameManager::AnnounceResult() {
 		loser = (winner == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
 	}
 
-	switch (mGameStats.reason) {
+	switch (gameStats.reason) {
 	case GameOverReason::NO_PIECES:
 		if (loser != PlayerColor::NONE) reasonDisplayStr = PlayerColorToString(loser, m_i18n) + m_i18n.GetString("reason_no_pieces");
 		else reasonDisplayStr = m_i18n.GetString("reason_player_no_pieces");
@@ -537,7 +494,7 @@ void GameManager::AnnounceResult() {
 	case GameOverReason::STALEMATE_BY_RULES: reasonDisplayStr = m_i18n.GetString("reason_stalemate_rules"); break;
 	default:
 		if (winner != PlayerColor::NONE && loser != PlayerColor::NONE) {
-			reasonDisplayStr = (mGameBoard.GetPieceCount(loser) == 0) ?
+			reasonDisplayStr = (mEngine.GetBoard().GetPieceCount(loser) == 0) ?
 				PlayerColorToString(loser, m_i18n) + m_i18n.GetString("reason_no_pieces") :
 				PlayerColorToString(loser, m_i18n) + m_i18n.GetString("reason_ended_unspecified");
 		}
@@ -547,13 +504,13 @@ void GameManager::AnnounceResult() {
 		break;
 	}
 	gameResultData.reason = reasonDisplayStr;
-	gameResultData.totalTurns = mGameStats.currentTurnNumber;
+	gameResultData.totalTurns = gameStats.currentTurnNumber;
 
-	if (winner == PlayerColor::PLAYER_1) { gameResultData.winnerCaptures = mGameStats.player1CapturedCount; gameResultData.loserCaptures = mGameStats.player2CapturedCount; }
-	else if (winner == PlayerColor::PLAYER_2) { gameResultData.winnerCaptures = mGameStats.player2CapturedCount; gameResultData.loserCaptures = mGameStats.player1CapturedCount; }
+	if (winner == PlayerColor::PLAYER_1) { gameResultData.winnerCaptures = gameStats.player1CapturedCount; gameResultData.loserCaptures = gameStats.player2CapturedCount; }
+	else if (winner == PlayerColor::PLAYER_2) { gameResultData.winnerCaptures = gameStats.player2CapturedCount; gameResultData.loserCaptures = gameStats.player1CapturedCount; }
 	else { // Empate o salida sin ganador claro de piezas
-		gameResultData.winnerCaptures = mGameStats.player1CapturedCount; // O mostrar ambos sin etiqueta "ganador"
-		gameResultData.loserCaptures = mGameStats.player2CapturedCount;
+		gameResultData.winnerCaptures = gameStats.player1CapturedCount; // O mostrar ambos sin etiqueta "ganador"
+		gameResultData.loserCaptures = gameStats.player2CapturedCount;
 	}
 
 	if (winner != PlayerColor::NONE) {
@@ -6,7 +6,10 @@
 #include "CommonTypes.h"
 #include "Board.h"
 #include "MoveGenerator.h"
+#include "GameEngine.h"  // Nucleo del juego sin entrada/salida
 #include "FileHandler.h" // Ya estaba, necesario para mFileHandler
+#include "EndgameTablebase.h" // Tablas de finales para la IA
+#include "OpeningBook.h" // Libro de aperturas para la IA
 #include <memory>        // Para std::unique_ptr
 #include <string>        // Para std::string
 
@@ -28,11 +31,21 @@ enum class GameMode {
 	COMPUTER_VS_COMPUTER
 };
 
+// Motor de IA de los jugadores controlados por la computadora
+// ALPHA_BETA: busqueda alfa-beta (ComputerPlayer)
+// MCTS: busqueda de arbol Monte Carlo (MctsComputerPlayer)
+enum class AiEngine {
+	ALPHA_BETA,
+	MCTS
+};
+
+// Interfaz de consola del juego. Las reglas, los turnos y las estadisticas viven en GameEngine;
+// GameManager solo muestra el estado, pide los movimientos a los jugadores y traduce los resultados a mensajes.
 class GameManager {
 public:
 	// Constructor de GameManager
-	// Recibe una referencia al tablero y al manejador de entrada
-	GameManager(Board& board, InputHandler& inputHandler);
+	// Recibe una referencia al manejador de entrada
+	GameManager(InputHandler& inputHandler);
 	
 	// Destructor de GameManager
 	~GameManager();
@@ -47,22 +60,16 @@ public:
 private:
 	LocalizationManager m_i18n; // Maneja la localizacion y traduccion de textos
 	ConsoleView mView; // Vista para mostrar informacion en consola
-	Board& mGameBoard; // Referencia al tablero de juego
 	//ConsoleView& mView;
 	InputHandler& mInputHandler; // Referencia al manejador de entrada del usuario
-	MoveGenerator mMoveGenerator; // Generador de movimientos validos
 	FileHandler mFileHandler; // Objeto para manejar archivos de resultados
 
-	PlayerColor mCurrentPlayerTurnColor; // Color del jugador que tiene el turno actual
-	bool mIsGameOver; // Indica si la partida ha terminado
-	GameStats mGameStats; // Estadisticas de la partida actual
-	Move mLastMove; // Ultimo movimiento realizado
-
-	bool mInCaptureSequence; // Indica si se esta en una secuencia de capturas obligatorias
-	int mForcedPieceRow; // Fila de la pieza obligada a capturar
-	int mForcedPieceCol; // Columna de la pieza obligada a capturar
+	GameEngine mEngine; // Tablero, reglas, turnos y estadisticas de la partida actual
+	EndgameTablebase mTablebase; // Tablas de finales (vacias si no se encuentra el archivo)
+	OpeningBook mOpeningBook; // Libro de aperturas (vacio si no se encuentra el archivo)
 
 	GameMode mCurrentGameMode; // Modo de juego actual
+	AiEngine mAiEngine; // Motor de IA con el que se crean los jugadores de la computadora
 
 	std::unique_ptr<Player> m_player1; // Puntero al jugador 1 (puede ser humano o IA)
 	std::unique_ptr<Player> m_player2; // Puntero al jugador 2 (puede ser humano o IA)
@@ -73,8 +80,10 @@ private:
 	void ShowMainMenu();
 	// Procesa el turno del jugador actual
 	void ProcessPlayerTurn();
-	// Cambia el turno al otro jugador
-	void SwitchPlayer();
+	// Crea un jugador IA con el motor elegido; la busqueda alfa-beta usa las tablas de finales y el libro cargados
+	std::unique_ptr<Player> CreateComputerPlayer(PlayerColor color);
+	// Actualiza el jugador activo segun el turno del motor
+	void SyncCurrentPlayerObject();
 	// Anuncia el resultado de la partida y guarda los datos
 	void AnnounceResult();      // Aqui se prepararan los datos para GameResult y se guardaran
 	// Muestra las estadisticas actuales de la partida
@@ -15,8 +15,7 @@ MoveInput HumanPlayer::GetChosenMoveInput(
 	const MoveGenerator& moveGenerator,
 	bool isInCaptureSequence,
 	int forcedRow,
-	int forcedCol,
-	const std::vector<Move>& availableMandatoryJumps
+	int forcedCol
 ) {
 	// Solicita el movimiento al usuario segun el color del jugador
 	MoveInput userInput = m_inputHandler.GetPlayerMoveInput(m_color);
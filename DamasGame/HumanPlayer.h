@@ -18,8 +18,7 @@ public:
 		const MoveGenerator& moveGenerator,
 		bool isInCaptureSequence,
 		int forcedRow,
-		int forcedCol,
-		const std::vector<Move>& availableMandatoryJumps
+		int forcedCol
 	) override;
 
 private:
@@ -0,0 +1,106 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h> // Para CreateFileMapping y MapViewOfFile
+#else
+#include <fcntl.h>    // Para open
+#include <sys/mman.h> // Para mmap y munmap
+#include <sys/stat.h> // Para fstat
+#include <unistd.h>   // Para close
+#endif
+
+// Constructor de MappedFile: sin archivo abierto
+MappedFile::MappedFile()
+	: mData(nullptr),
+	mSize(0)
+#ifdef _WIN32
+	, mFileHandle(nullptr),
+	mMappingHandle(nullptr)
+#endif
+{
+}
+
+// Destructor de MappedFile: libera la proyeccion si queda alguna abierta
+MappedFile::~MappedFile() {
+	Close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& path) {
+	Close();
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr) {
+		CloseHandle(file);
+		return false;
+	}
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+	mFileHandle = file;
+	mMappingHandle = mapping;
+	mData = static_cast<const unsigned char*>(view);
+	mSize = static_cast<std::size_t>(fileSize.QuadPart);
+	return true;
+}
+
+void MappedFile::Close() {
+	if (mData) {
+		UnmapViewOfFile(mData);
+	}
+	if (mMappingHandle) {
+		CloseHandle(mMappingHandle);
+	}
+	if (mFileHandle) {
+		CloseHandle(mFileHandle);
+	}
+	mData = nullptr;
+	mSize = 0;
+	mFileHandle = nullptr;
+	mMappingHandle = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path) {
+	Close();
+	int file = open(path.c_str(), O_RDONLY);
+	if (file < 0) {
+		return false;
+	}
+	struct stat fileInfo;
+	if (fstat(file, &fileInfo) != 0 || fileInfo.st_size == 0) {
+		close(file);
+		return false;
+	}
+	void* view = mmap(nullptr, static_cast<std::size_t>(fileInfo.st_size), PROT_READ, MAP_SHARED, file, 0);
+	close(file); // La proyeccion sigue valida sin el descriptor
+	if (view == MAP_FAILED) {
+		return false;
+	}
+	mData = static_cast<const unsigned char*>(view);
+	mSize = static_cast<std::size_t>(fileInfo.st_size);
+	return true;
+}
+
+void MappedFile::Close() {
+	if (mData) {
+		munmap(const_cast<unsigned char*>(mData), mSize);
+	}
+	mData = nullptr;
+	mSize = 0;
+}
+
+#endif
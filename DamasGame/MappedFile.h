@@ -0,0 +1,52 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef> // Para std::size_t
+#include <cstdint> // Para std::uint32_t y std::uint64_t
+#include <string>
+
+// Archivo binario de solo lectura proyectado en memoria.
+// El sistema operativo trae las paginas del disco a medida que se leen y las comparte entre procesos,
+// asi que abrir un archivo grande (por ejemplo, las tablas de finales) no lo copia ni lo lee entero.
+class MappedFile {
+public:
+	MappedFile();
+	~MappedFile();
+
+	// La proyeccion pertenece a un solo objeto
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	// Proyecta el archivo completo. Devuelve false si no existe, esta vacio o no se puede proyectar.
+	// Si ya habia un archivo abierto, se cierra antes.
+	bool Open(const std::string& path);
+	// Libera la proyeccion (no hace nada si no hay archivo abierto)
+	void Close();
+
+	bool IsOpen() const { return mData != nullptr; }
+	// Primer byte del archivo (nullptr si no hay archivo abierto)
+	const unsigned char* GetData() const { return mData; }
+	// Tamano del archivo en bytes
+	std::size_t GetSize() const { return mSize; }
+
+private:
+	const unsigned char* mData; // Contenido del archivo proyectado
+	std::size_t mSize;          // Tamano del archivo en bytes
+#ifdef _WIN32
+	void* mFileHandle;    // HANDLE del archivo abierto
+	void* mMappingHandle; // HANDLE del objeto de proyeccion
+#endif
+};
+
+// Lectura de enteros little-endian de un archivo proyectado, sin depender del orden de bytes de la maquina
+// ni de la alineacion de 'data'
+inline std::uint32_t ReadUint32(const unsigned char* data) {
+	return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8) |
+		(static_cast<std::uint32_t>(data[2]) << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+inline std::uint64_t ReadUint64(const unsigned char* data) {
+	return static_cast<std::uint64_t>(ReadUint32(data)) | (static_cast<std::uint64_t>(ReadUint32(data + 4)) << 32);
+}
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,52 @@
+#include "MctsComputerPlayer.h"
+#include "CommonTypes.h"
+#include "Board.h"
+
+#include <chrono>
+
+// Constructor de MctsComputerPlayer
+// Siembra los generadores aleatorios con la hora actual, igual que ComputerPlayer
+MctsComputerPlayer::MctsComputerPlayer(PlayerColor color, const MoveGenerator& moveGenerator, int difficulty, int poolSizeMb)
+	: AiPlayer(color),
+	m_difficulty(difficulty),
+	m_search(moveGenerator, poolSizeMb),
+	m_lastResult() {
+	SetRandomSeed(static_cast<unsigned>(std::chrono::system_clock::now().time_since_epoch().count()));
+}
+
+// Dificultad 1 -> 5000 simulaciones por jugada, creciendo con el cuadrado del nivel (125000 en el nivel 5)
+long long MctsComputerPlayer::PlayoutsForDifficulty(int difficulty) {
+	const int minDifficulty = 1;
+	const int maxDifficulty = 5;
+	if (difficulty < minDifficulty) difficulty = minDifficulty;
+	if (difficulty > maxDifficulty) difficulty = maxDifficulty;
+	return 5000LL * difficulty * difficulty;
+}
+
+void MctsComputerPlayer::SetRandomSeed(unsigned seed) {
+	AiPlayer::SetRandomSeed(seed);
+	m_search.SetRandomSeed(seed);
+}
+
+// Los candidatos son movimientos completos; con uno solo no hay nada que simular
+MoveSequence MctsComputerPlayer::ChooseSequence(const Board& board, bool /*isInCaptureSequence*/, const MoveSequenceList& legalMoves) {
+	m_lastResult = MctsResult();
+	if (legalMoves.size() == 1) {
+		return legalMoves[0];
+	}
+
+	MctsLimits limits;
+	limits.threads = m_searchThreads;
+	if (m_timeManager.IsActive()) {
+		// MCTS se puede cortar en cualquier simulacion: con tiempo por jugada se usa todo el limite duro,
+		// con reloj por partida la parte que le corresponde a la jugada (el limite blando)
+		SearchLimits timeLimits;
+		m_timeManager.AllocateMoveTime(timeLimits);
+		limits.maxTimeMs = (m_timeManager.GetTimeControl().moveTimeMs > 0) ? timeLimits.maxTimeMs : timeLimits.softTimeMs;
+	}
+	else {
+		limits.maxPlayouts = PlayoutsForDifficulty(m_difficulty);
+	}
+	m_lastResult = m_search.Search(board, m_color, legalMoves, limits);
+	return m_lastResult.bestMove;
+}
@@ -0,0 +1,46 @@
+#ifndef MCTS_COMPUTER_PLAYER_H
+#define MCTS_COMPUTER_PLAYER_H
+
+#include "AiPlayer.h"      // Clase base de las IA (cadenas salto a salto, reloj y pausa)
+#include "MoveGenerator.h" // Para generar los candidatos
+#include "MoveSequence.h"  // Para MoveSequence (cadenas de captura completas)
+#include "MctsSearch.h"    // Para la busqueda de arbol Monte Carlo
+#include <vector>          // Para std::vector
+
+// Jugador controlado por la computadora que elige sus movimientos con una busqueda de arbol Monte Carlo
+// (UCT con partidas al azar) en lugar de la busqueda alfa-beta de ComputerPlayer. Se usa igual que
+// ComputerPlayer: GameManager y SelfPlay lo crean en su lugar segun el motor de IA elegido.
+class MctsComputerPlayer : public AiPlayer {
+public:
+	// Constructor de MctsComputerPlayer
+	// color: color asignado al jugador (blanco o negro)
+	// moveGenerator: reglas de movimiento que usa la busqueda MCTS
+	// difficulty: nivel de dificultad de la IA (por defecto 1), determina las simulaciones por jugada
+	// poolSizeMb: tamano en MB del pool de nodos de cada hilo
+	MctsComputerPlayer(PlayerColor color, const MoveGenerator& moveGenerator, int difficulty = 1,
+		int poolSizeMb = MctsSearch::DEFAULT_POOL_SIZE_MB);
+
+	// Devuelve las simulaciones por jugada asociadas a un nivel de dificultad
+	static long long PlayoutsForDifficulty(int difficulty);
+
+	// Fija la semilla de los generadores aleatorios, el de la pausa y los de la busqueda
+	void SetRandomSeed(unsigned seed) override;
+
+	// Resultado de la ultima busqueda (simulaciones, nodos y tiempo)
+	const MctsResult& GetLastResult() const { return m_lastResult; }
+
+protected:
+	// Elige el movimiento completo del turno con MCTS. Los hilos de la busqueda construyen cada uno su propio
+	// arbol (paralelismo en la raiz); con control de tiempo se simula hasta agotar el tiempo de la jugada,
+	// sin limite de simulaciones.
+	MoveSequence ChooseSequence(const Board& board, bool isInCaptureSequence, const MoveSequenceList& legalMoves) override;
+
+private:
+	int m_difficulty;                        // Nivel de dificultad de la IA
+
+	// Busqueda de arbol Monte Carlo (conserva los pools de nodos entre turnos)
+	MctsSearch m_search;
+	MctsResult m_lastResult;
+};
+
+#endif // MCTS_COMPUTER_PLAYER_H
@@ -0,0 +1,234 @@
+#include "MctsSearch.h"
+
+#include <chrono> // Para el limite de tiempo
+#include <cmath>  // Para std::log y std::sqrt
+#include <thread> // Para el paralelismo en la raiz
+
+namespace {
+	PlayerColor Opponent(PlayerColor player) {
+		return (player == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+	}
+}
+
+// Constructor de MctsNodePool: reserva todos los nodos de una vez
+MctsNodePool::MctsNodePool(std::size_t capacity)
+	: mNodes(capacity),
+	mUsed(0) {
+}
+
+std::int32_t MctsNodePool::Allocate(int count) {
+	if (count > static_cast<int>(mNodes.size() - mUsed)) {
+		return -1;
+	}
+	std::int32_t first = static_cast<std::int32_t>(mUsed);
+	mUsed += count;
+	return first;
+}
+
+// Constructor de MctsSearch: los pools de cada hilo se crean en la primera busqueda que los usa
+MctsSearch::MctsSearch(const MoveGenerator& moveGenerator, int poolSizeMb)
+	: mMoveGenerator(moveGenerator),
+	mPoolCapacity(static_cast<std::size_t>(poolSizeMb < 1 ? 1 : poolSizeMb) * 1024 * 1024 / sizeof(MctsNode)),
+	mSeed(0),
+	mWorkers() {
+}
+
+void MctsSearch::SetRandomSeed(unsigned seed) {
+	mSeed = seed;
+	for (std::size_t i = 0; i < mWorkers.size(); ++i) {
+		mWorkers[i]->rng.seed(seed + static_cast<unsigned>(i));
+	}
+}
+
+MctsResult MctsSearch::Search(const Board& board, PlayerColor sideToMove, const MoveSequenceList& rootMoves, const MctsLimits& limits) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	MctsResult result;
+	if (rootMoves.empty()) {
+		return result;
+	}
+	int threads = (limits.threads < 1) ? 1 : limits.threads;
+	while (static_cast<int>(mWorkers.size()) < threads) {
+		mWorkers.emplace_back(new Worker(mPoolCapacity));
+		mWorkers.back()->rng.seed(mSeed + static_cast<unsigned>(mWorkers.size() - 1));
+	}
+	long long playoutsPerThread = (limits.maxPlayouts > 0) ? (limits.maxPlayouts + threads - 1) / threads : 0;
+
+	Board rootBoard = board;
+	rootBoard.SetSideToMove(sideToMove);
+	if (threads == 1) {
+		RunWorker(*mWorkers[0], rootBoard, rootMoves, playoutsPerThread, limits.maxTimeMs);
+	}
+	else {
+		std::vector<std::thread> workerThreads;
+		for (int thread = 0; thread < threads; ++thread) {
+			workerThreads.emplace_back([&, thread]() {
+				RunWorker(*mWorkers[thread], rootBoard, rootMoves, playoutsPerThread, limits.maxTimeMs);
+			});
+		}
+		for (std::thread& workerThread : workerThreads) {
+			workerThread.join();
+		}
+	}
+
+	// Los hijos de la raiz son rootMoves en el mismo orden en todos los arboles (nodos 1..N de cada pool)
+	std::vector<std::uint64_t> visits(rootMoves.size(), 0);
+	std::vector<double> scores(rootMoves.size(), 0.0);
+	for (int thread = 0; thread < threads; ++thread) {
+		Worker& worker = *mWorkers[thread];
+		result.playouts += worker.playouts;
+		result.treeNodes += static_cast<long long>(worker.pool.GetUsed());
+		if (worker.pool.GetUsed() <= static_cast<std::size_t>(rootMoves.size())) {
+			continue;
+		}
+		for (int i = 0; i < rootMoves.size(); ++i) {
+			const MctsNode& child = worker.pool[1 + i];
+			visits[i] += child.visits;
+			scores[i] += child.score;
+		}
+	}
+	int best = 0;
+	for (int i = 1; i < rootMoves.size(); ++i) {
+		if (visits[i] > visits[best]) {
+			best = i;
+		}
+	}
+	result.bestMove = rootMoves[best];
+	result.winRate = (visits[best] > 0) ? scores[best] / visits[best] : 0.0;
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+// La raiz (nodo 0) se expande con rootMoves en lugar de generar sus movimientos, para que los hijos
+// coincidan entre arboles y con la lista del llamador
+void MctsSearch::RunWorker(Worker& worker, const Board& board, const MoveSequenceList& rootMoves,
+	long long maxPlayouts, long long maxTimeMs) const {
+	const int timeCheckInterval = 32; // Simulaciones entre consultas al reloj
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	worker.playouts = 0;
+	worker.pool.Reset();
+	std::int32_t root = worker.pool.Allocate(1);
+	std::int32_t firstChild = worker.pool.Allocate(rootMoves.size());
+	if (root < 0 || firstChild < 0) {
+		return;
+	}
+	worker.pool[root] = MctsNode();
+	worker.pool[root].firstChild = firstChild;
+	worker.pool[root].childCount = rootMoves.size();
+	for (int i = 0; i < rootMoves.size(); ++i) {
+		worker.pool[firstChild + i] = MctsNode();
+		worker.pool[firstChild + i].move = rootMoves[i];
+	}
+
+	while (maxPlayouts <= 0 || worker.playouts < maxPlayouts) {
+		if (maxTimeMs > 0 && worker.playouts % timeCheckInterval == 0 &&
+			std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() >= maxTimeMs) {
+			break;
+		}
+		RunPlayout(worker, board);
+		++worker.playouts;
+	}
+}
+
+void MctsSearch::RunPlayout(Worker& worker, const Board& rootBoard) const {
+	MctsNodePool& pool = worker.pool;
+	Board board = rootBoard;
+	PlayerColor sideToMove = rootBoard.GetSideToMove();
+	std::vector<std::int32_t>& path = worker.path;
+	path.clear();
+	std::int32_t node = 0;
+	path.push_back(node);
+
+	// Seleccion: se baja mientras el nodo tenga hijos; un hijo sin visitas es la hoja a simular
+	while (true) {
+		MctsNode& current = pool[node];
+		if (current.firstChild < 0) {
+			// Expansion: un nodo se expande en su segunda visita, asi las hojas de una sola visita no gastan pool
+			if (current.visits > 0 && Expand(pool, node, board, sideToMove)) {
+				continue;
+			}
+			break;
+		}
+		if (current.childCount == 0) {
+			break; // El bando que mueve no tiene movimientos: posicion final
+		}
+		node = SelectChild(pool, current);
+		ApplySequence(board, pool[node].move);
+		sideToMove = Opponent(sideToMove);
+		path.push_back(node);
+		if (pool[node].visits == 0) {
+			break;
+		}
+	}
+
+	// Simulacion: puntos del bando que mueve en la hoja
+	const MctsNode& leaf = pool[node];
+	float points = (leaf.firstChild >= 0 && leaf.childCount == 0)
+		? 0.0f
+		: Playout(board, sideToMove, sideToMove, worker.rng);
+
+	// Propagacion: cada nodo suma los puntos del bando que jugo el movimiento que lleva a el
+	for (std::int32_t index : path) {
+		MctsNode& pathNode = pool[index];
+		++pathNode.visits;
+		pathNode.score += (pathNode.move.playerColor_ == sideToMove) ? points : 1.0f - points;
+	}
+}
+
+std::int32_t MctsSearch::SelectChild(MctsNodePool& pool, const MctsNode& parent) const {
+	double logParentVisits = std::log(static_cast<double>(parent.visits));
+	std::int32_t best = parent.firstChild;
+	double bestValue = -1.0;
+	for (std::int32_t index = parent.firstChild; index < parent.firstChild + parent.childCount; ++index) {
+		const MctsNode& child = pool[index];
+		if (child.visits == 0) {
+			return index;
+		}
+		double value = child.score / child.visits + EXPLORATION * std::sqrt(logParentVisits / child.visits);
+		if (value > bestValue) {
+			bestValue = value;
+			best = index;
+		}
+	}
+	return best;
+}
+
+bool MctsSearch::Expand(MctsNodePool& pool, std::int32_t nodeIndex, const Board& board, PlayerColor sideToMove) const {
+	MoveSequenceList moves;
+	mMoveGenerator.GenerateMoveSequences(board, sideToMove, moves);
+	std::int32_t firstChild = moves.empty() ? 0 : pool.Allocate(moves.size());
+	if (firstChild < 0) {
+		return false;
+	}
+	for (int i = 0; i < moves.size(); ++i) {
+		pool[firstChild + i] = MctsNode();
+		pool[firstChild + i].move = moves[i];
+	}
+	MctsNode& node = pool[nodeIndex];
+	node.firstChild = firstChild;
+	node.childCount = moves.size();
+	return true;
+}
+
+float MctsSearch::Playout(Board& board, PlayerColor sideToMove, PlayerColor perspective, std::mt19937& rng) const {
+	MoveSequenceList moves;
+	for (int turn = 0; turn < MAX_PLAYOUT_TURNS; ++turn) {
+		mMoveGenerator.GenerateMoveSequences(board, sideToMove, moves);
+		if (moves.empty()) {
+			return (sideToMove == perspective) ? 0.0f : 1.0f;
+		}
+		ApplySequence(board, moves[static_cast<int>(rng() % static_cast<unsigned>(moves.size()))]);
+		sideToMove = Opponent(sideToMove);
+	}
+	int advantage = board.GetEvaluationAccumulator(perspective) - board.GetEvaluationAccumulator(Opponent(perspective));
+	if (advantage > DRAW_MARGIN) return 1.0f;
+	if (advantage < -DRAW_MARGIN) return 0.0f;
+	return 0.5f;
+}
+
+// Aplica una secuencia completa paso a paso con Board::MakeMove (no hace falta deshacerla: el tablero es una copia)
+void MctsSearch::ApplySequence(Board& board, const MoveSequence& sequence) {
+	for (int step = 0; step < sequence.numSteps_; ++step) {
+		board.MakeMove(sequence.GetCompactStep(step));
+	}
+	board.SetSideToMove(Opponent(sequence.playerColor_));
+}
@@ -0,0 +1,119 @@
+#ifndef MCTS_SEARCH_H
+#define MCTS_SEARCH_H
+
+#include "CommonTypes.h"   // Para PlayerColor
+#include "Board.h"         // Para Board
+#include "MoveGenerator.h" // Para generar las secuencias legales
+#include "MoveSequence.h"  // Para MoveSequence y MoveSequenceList
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Limites de una busqueda MCTS. Se detiene al agotar cualquiera de los dos (al menos uno debe ser > 0).
+struct MctsLimits {
+	long long maxPlayouts = 0; // Simulaciones en total, repartidas entre los hilos (0 = sin limite)
+	long long maxTimeMs = 0;   // Tiempo de la busqueda en milisegundos (0 = sin limite)
+	int threads = 1;           // Arboles independientes, uno por hilo (paralelismo en la raiz)
+};
+
+// Resultado de una busqueda MCTS
+struct MctsResult {
+	MoveSequence bestMove;   // Movimiento de la raiz con mas visitas (sumando todos los arboles)
+	double winRate = 0.0;    // Puntos medios del mejor movimiento para el bando que mueve (1 victoria, 0.5 tablas)
+	long long playouts = 0;  // Simulaciones jugadas en total
+	long long treeNodes = 0; // Nodos creados en total
+	double seconds = 0.0;    // Tiempo empleado en la busqueda
+};
+
+// Nodo del arbol: el movimiento que lleva a el y las estadisticas de las simulaciones que pasaron por el.
+// Los hijos de un nodo ocupan posiciones consecutivas del pool.
+struct MctsNode {
+	MoveSequence move;           // Movimiento desde el nodo padre (vacio en la raiz)
+	std::int32_t firstChild = -1; // Indice del primer hijo en el pool (-1 si no se expandio)
+	std::int32_t childCount = 0;  // Cantidad de hijos (0 en un nodo expandido = el bando que mueve perdio)
+	std::uint32_t visits = 0;     // Simulaciones que pasaron por el nodo
+	float score = 0.0f;           // Puntos del bando que jugo 'move' en esas simulaciones (1 victoria, 0.5 tablas)
+};
+
+// Arena de nodos de tamano fijo. Se reserva una vez y cada busqueda la vacia con Reset, asi que
+// crear nodos no reserva memoria: es avanzar un indice.
+class MctsNodePool {
+public:
+	explicit MctsNodePool(std::size_t capacity);
+
+	// Descarta todos los nodos (la memoria se conserva)
+	void Reset() { mUsed = 0; }
+	// Reserva 'count' nodos consecutivos y devuelve el indice del primero, o -1 si no caben
+	std::int32_t Allocate(int count);
+
+	MctsNode& operator[](std::int32_t index) { return mNodes[index]; }
+	std::size_t GetUsed() const { return mUsed; }
+	std::size_t GetCapacity() const { return mNodes.size(); }
+
+private:
+	std::vector<MctsNode> mNodes; // Nodos reservados
+	std::size_t mUsed;            // Nodos entregados desde el ultimo Reset
+};
+
+// Busqueda de arbol Monte Carlo con UCT (Upper Confidence bounds applied to Trees).
+// Cada simulacion baja por el arbol eligiendo el hijo con mejor UCT, expande el nodo al que llega (cuando
+// ya tiene una visita) y juega desde ahi una partida al azar con MoveGenerator. Los movimientos son turnos
+// completos (cadenas de captura enteras), igual que en SearchEngine.
+// Las partidas al azar se cortan tras MAX_PLAYOUT_TURNS turnos y se adjudican por material (los
+// acumuladores de evaluacion del tablero): gana quien lleva mas de DRAW_MARGIN de ventaja, si no son tablas.
+//
+// Con varios hilos cada uno construye su propio arbol desde la raiz, con su pool y su generador aleatorio,
+// sin compartir nada (paralelismo en la raiz). Al terminar se suman las visitas de cada movimiento de la
+// raiz y se juega el mas visitado.
+class MctsSearch {
+public:
+	static constexpr double EXPLORATION = 1.0;     // Constante de exploracion de UCT
+	static constexpr int MAX_PLAYOUT_TURNS = 60;   // Turnos maximos de una partida al azar antes de adjudicarla
+	static constexpr int DRAW_MARGIN = 150;        // Ventaja de material minima para adjudicar una victoria
+	static constexpr int DEFAULT_POOL_SIZE_MB = 32; // Tamano por defecto del pool de cada hilo
+
+	// moveGenerator: reglas de movimiento (solo se usan metodos const, se puede compartir entre hilos)
+	// poolSizeMb: tamano del pool de nodos de cada hilo
+	MctsSearch(const MoveGenerator& moveGenerator, int poolSizeMb = DEFAULT_POOL_SIZE_MB);
+
+	// Busca el mejor movimiento de 'sideToMove' entre 'rootMoves' (no vacia)
+	MctsResult Search(const Board& board, PlayerColor sideToMove, const MoveSequenceList& rootMoves, const MctsLimits& limits);
+
+	// Fija la semilla de los generadores aleatorios (el hilo i usa seed + i)
+	void SetRandomSeed(unsigned seed);
+
+private:
+	// Arbol de un hilo: su pool y su generador aleatorio se conservan entre busquedas
+	struct Worker {
+		MctsNodePool pool;
+		std::mt19937 rng;
+		std::vector<std::int32_t> path; // Nodos recorridos por la simulacion actual (se reutiliza)
+		long long playouts = 0;         // Simulaciones de la ultima busqueda
+
+		explicit Worker(std::size_t capacity) : pool(capacity), rng(), path() {}
+	};
+
+	const MoveGenerator& mMoveGenerator;
+	std::size_t mPoolCapacity; // Nodos del pool de cada hilo
+	unsigned mSeed;            // Semilla de los generadores aleatorios
+	std::vector<std::unique_ptr<Worker>> mWorkers; // Se crean la primera vez que se usa cada hilo
+
+	// Construye el arbol de un hilo hasta agotar su parte de los limites
+	void RunWorker(Worker& worker, const Board& board, const MoveSequenceList& rootMoves,
+		long long maxPlayouts, long long maxTimeMs) const;
+	// Una simulacion completa: seleccion, expansion, partida al azar y propagacion
+	void RunPlayout(Worker& worker, const Board& rootBoard) const;
+	// Hijo con mejor UCT
+	std::int32_t SelectChild(MctsNodePool& pool, const MctsNode& parent) const;
+	// Crea los hijos de un nodo; devuelve false si el pool esta lleno (el nodo queda sin expandir)
+	bool Expand(MctsNodePool& pool, std::int32_t nodeIndex, const Board& board, PlayerColor sideToMove) const;
+	// Juega al azar desde 'board' y devuelve los puntos de 'perspective' (1, 0.5 o 0)
+	float Playout(Board& board, PlayerColor sideToMove, PlayerColor perspective, std::mt19937& rng) const;
+
+	static void ApplySequence(Board& board, const MoveSequence& sequence);
+};
+
+#endif // MCTS_SEARCH_H
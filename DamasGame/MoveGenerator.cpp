@@ -2,8 +2,15 @@
 #include "Board.h"       // Para Board::BOARD_SIZE y metodos de Board
 #include "CommonTypes.h" // Para PieceType, PlayerColor, Move
 
-#include <vector>
 #include <algorithm> 
+#include <cstdlib> // Para std::abort
+
+namespace {
+	// Direcciones de avance de los peones de cada jugador
+	const Direction P1_FORWARD_DIRECTIONS[] = { Direction::UP_LEFT, Direction::UP_RIGHT };
+	const Direction P2_FORWARD_DIRECTIONS[] = { Direction::DOWN_LEFT, Direction::DOWN_RIGHT };
+	const Direction ALL_DIRECTIONS[] = { Direction::UP_LEFT, Direction::UP_RIGHT, Direction::DOWN_LEFT, Direction::DOWN_RIGHT };
+}
 
 // Constructor de MoveGenerator
 MoveGenerator::MoveGenerator() {
@@ -18,99 +25,73 @@ PlayerColor MoveGenerator::GetPlayerFromPiece(PieceType piece) const {
 }
 
 // Busca movimientos simples (sin captura) para un peon
-void MoveGenerator::FindSimplePawnMoves(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, std::vector<Move>& moves) const {
+void MoveGenerator::FindSimplePawnMoves(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, MoveList& moves) const {
 	if (piece != PieceType::P1_MAN && piece != PieceType::P2_MAN) return;
 
-	int forwardDirection = (player == PlayerColor::PLAYER_1) ? -1 : 1;
-	int dCols[] = { -1, 1 };
-
-	for (int dc : dCols) {
-		int endRow = r + forwardDirection;
-		int endCol = c + dc;
-		// Solo agrega el movimiento si la casilla destino esta vacia
-		if (gameBoard.IsWithinBounds(endRow, endCol) && gameBoard.GetPieceAt(endRow, endCol) == PieceType::EMPTY) {
-			moves.push_back({ r, c, endRow, endCol, piece, player, false });
+	int square = Board::ToSquareIndex(r, c);
+	const Direction* forwardDirections = (player == PlayerColor::PLAYER_1) ? P1_FORWARD_DIRECTIONS : P2_FORWARD_DIRECTIONS;
+	for (int i = 0; i < 2; ++i) {
+		int to = NeighborSquare(square, forwardDirections[i]);
+		// Solo agrega el movimiento si la casilla destino existe y esta vacia
+		if (to != NO_SQUARE && gameBoard.GetPieceAtSquare(to) == PieceType::EMPTY) {
+			moves.push_back({ r, c, Board::SquareToRow(to), Board::SquareToCol(to), piece, player, false });
 		}
 	}
 }
 
 // Busca movimientos de salto (captura) para un peon
-void MoveGenerator::FindPawnJumps(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, std::vector<Move>& moves) const {
+void MoveGenerator::FindPawnJumps(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, MoveList& moves) const {
 	if (piece != PieceType::P1_MAN && piece != PieceType::P2_MAN) return;
 
 	PlayerColor opponentColor = (player == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
-	PieceType opponentPawn = (opponentColor == PlayerColor::PLAYER_1) ? PieceType::P1_MAN : PieceType::P2_MAN;
-	PieceType opponentKing = (opponentColor == PlayerColor::PLAYER_1) ? PieceType::P1_KING : PieceType::P2_KING;
-
-	int forwardDirection = (player == PlayerColor::PLAYER_1) ? -1 : 1;
-	int jumpOffsets[][2] = { {forwardDirection, -1}, {forwardDirection, 1} };
-
-	for (const auto& offset : jumpOffsets) {
-		int capturedRow = r + offset[0];
-		int capturedCol = c + offset[1];
-		int landingRow = r + 2 * offset[0];
-		int landingCol = c + 2 * offset[1];
-
-		if (gameBoard.IsWithinBounds(landingRow, landingCol) &&
-			gameBoard.GetPieceAt(landingRow, landingCol) == PieceType::EMPTY) {
-			if (gameBoard.IsWithinBounds(capturedRow, capturedCol)) {
-				PieceType pieceAtCapturedPos = gameBoard.GetPieceAt(capturedRow, capturedCol);
-				if (pieceAtCapturedPos == opponentPawn || pieceAtCapturedPos == opponentKing) {
-					moves.push_back({ r, c, landingRow, landingCol, piece, player, true });
-				}
-			}
+	Bitboard opponents = gameBoard.GetPlayerBitboard(opponentColor);
+	Bitboard empty = gameBoard.GetEmptyBitboard();
+
+	int square = Board::ToSquareIndex(r, c);
+	const Direction* forwardDirections = (player == PlayerColor::PLAYER_1) ? P1_FORWARD_DIRECTIONS : P2_FORWARD_DIRECTIONS;
+	for (int i = 0; i < 2; ++i) {
+		int landing = JumpSquare(square, forwardDirections[i]);
+		// Si el aterrizaje existe, la casilla saltada tambien
+		if (landing != NO_SQUARE && (empty & SquareBit(landing)) &&
+			(opponents & SquareBit(NeighborSquare(square, forwardDirections[i])))) {
+			moves.push_back({ r, c, Board::SquareToRow(landing), Board::SquareToCol(landing), piece, player, true });
 		}
 	}
 }
 
 // Busca movimientos simples (sin captura) para una dama
-void MoveGenerator::FindSimpleKingMoves(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, std::vector<Move>& moves) const {
+void MoveGenerator::FindSimpleKingMoves(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, MoveList& moves) const {
 	if (piece != PieceType::P1_KING && piece != PieceType::P2_KING) return;
 
-	int dRows[] = { -1, -1,  1,  1 };
-	int dCols[] = { -1,  1, -1,  1 };
-
-	for (int i = 0; i < 4; ++i) {
-		int endRow = r + dRows[i];
-		int endCol = c + dCols[i];
-		if (gameBoard.IsWithinBounds(endRow, endCol) && gameBoard.GetPieceAt(endRow, endCol) == PieceType::EMPTY) {
-			moves.push_back({ r, c, endRow, endCol, piece, player, false });
+	int square = Board::ToSquareIndex(r, c);
+	for (Direction dir : ALL_DIRECTIONS) {
+		int to = NeighborSquare(square, dir);
+		if (to != NO_SQUARE && gameBoard.GetPieceAtSquare(to) == PieceType::EMPTY) {
+			moves.push_back({ r, c, Board::SquareToRow(to), Board::SquareToCol(to), piece, player, false });
 		}
 	}
 }
 
 // Busca movimientos de salto (captura) para una dama
-void MoveGenerator::FindKingJumps(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, std::vector<Move>& moves) const {
+void MoveGenerator::FindKingJumps(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, MoveList& moves) const {
 	if (piece != PieceType::P1_KING && piece != PieceType::P2_KING) return;
 
 	PlayerColor opponentColor = (player == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
-	PieceType opponentPawn = (opponentColor == PlayerColor::PLAYER_1) ? PieceType::P1_MAN : PieceType::P2_MAN;
-	PieceType opponentKing = (opponentColor == PlayerColor::PLAYER_1) ? PieceType::P1_KING : PieceType::P2_KING;
-
-	int dRows[] = { -1, -1,  1,  1 };
-	int dCols[] = { -1,  1, -1,  1 };
-
-	for (int i = 0; i < 4; ++i) {
-		int capturedRow = r + dRows[i];
-		int capturedCol = c + dCols[i];
-		int landingRow = r + 2 * dRows[i];
-		int landingCol = c + 2 * dCols[i];
-
-		if (gameBoard.IsWithinBounds(landingRow, landingCol) &&
-			gameBoard.GetPieceAt(landingRow, landingCol) == PieceType::EMPTY) {
-			if (gameBoard.IsWithinBounds(capturedRow, capturedCol)) {
-				PieceType pieceAtCapturedPos = gameBoard.GetPieceAt(capturedRow, capturedCol);
-				if (pieceAtCapturedPos == opponentPawn || pieceAtCapturedPos == opponentKing) {
-					moves.push_back({ r, c, landingRow, landingCol, piece, player, true });
-				}
-			}
+	Bitboard opponents = gameBoard.GetPlayerBitboard(opponentColor);
+	Bitboard empty = gameBoard.GetEmptyBitboard();
+
+	int square = Board::ToSquareIndex(r, c);
+	for (Direction dir : ALL_DIRECTIONS) {
+		int landing = JumpSquare(square, dir);
+		if (landing != NO_SQUARE && (empty & SquareBit(landing)) && (opponents & SquareBit(NeighborSquare(square, dir)))) {
+			moves.push_back({ r, c, Board::SquareToRow(landing), Board::SquareToCol(landing), piece, player, true });
 		}
 	}
 }
 
 // Retorna todos los saltos posibles para una pieza especifica
-std::vector<Move> MoveGenerator::GetPossibleJumpsForSpecificPiece(const Board& gameBoard, int pieceRow, int pieceCol) const {
-	std::vector<Move> jumps;
+MoveList MoveGenerator::GetPossibleJumpsForSpecificPiece(const Board& gameBoard, int pieceRow, int pieceCol) const {
+	MoveList jumps;
 	PieceType piece = gameBoard.GetPieceAt(pieceRow, pieceCol);
 	PlayerColor player = GetPlayerFromPiece(piece);
 
@@ -128,8 +109,8 @@ std::vector<Move> MoveGenerator::GetPossibleJumpsForSpecificPiece(const Board& g
 }
 
 // Genera todos los movimientos posibles (simples y saltos) para una pieza
-std::vector<Move> MoveGenerator::GenerateMovesForPiece(const Board& gameBoard, int startRow, int startCol) const {
-	std::vector<Move> generatedMoves;
+MoveList MoveGenerator::GenerateMovesForPiece(const Board& gameBoard, int startRow, int startCol) const {
+	MoveList generatedMoves;
 	PieceType piece = gameBoard.GetPieceAt(startRow, startCol);
 	PlayerColor player = GetPlayerFromPiece(piece);
 
@@ -153,35 +134,31 @@ std::vector<Move> MoveGenerator::GenerateMovesForPiece(const Board& gameBoard, i
 	return generatedMoves;
 }
 
-// Determina el tipo de accion obligatoria (ninguna, captura dama, captura peon) y llena la lista de movimientos obligatorios
-MandatoryActionType MoveGenerator::GetMandatoryActionType(const Board& gameBoard, PlayerColor player, std::vector<Move>& outMandatoryMoves) const {
+// Determina el tipo de accion obligatoria (ninguna, captura dama, captura peon) y llena la lista de movimientos obligatorios.
+// Los saltos se escriben directamente en la lista de salida: primero los de las Damas y, solo si no hay
+// ninguno, los de los peones.
+MandatoryActionType MoveGenerator::GetMandatoryActionType(const Board& gameBoard, PlayerColor player, MoveList& outMandatoryMoves) const {
 	outMandatoryMoves.clear();
-	std::vector<Move> kingJumps;
-	std::vector<Move> pawnJumps;
-
-	for (int r = 0; r < gameBoard.GetBoardSize(); ++r) {
-		for (int c = 0; c < gameBoard.GetBoardSize(); ++c) {
-			PieceType piece = gameBoard.GetPieceAt(r, c);
-			if (GetPlayerFromPiece(piece) == player) {
-				std::vector<Move> jumpsForThisPiece;
-				if (piece == PieceType::P1_KING || piece == PieceType::P2_KING) {
-					FindKingJumps(gameBoard, r, c, player, piece, jumpsForThisPiece);
-					kingJumps.insert(kingJumps.end(), jumpsForThisPiece.begin(), jumpsForThisPiece.end());
-				}
-				else if (piece == PieceType::P1_MAN || piece == PieceType::P2_MAN) {
-					FindPawnJumps(gameBoard, r, c, player, piece, jumpsForThisPiece);
-					pawnJumps.insert(pawnJumps.end(), jumpsForThisPiece.begin(), jumpsForThisPiece.end());
-				}
-			}
-		}
+	bool isPlayer1 = (player == PlayerColor::PLAYER_1);
+	PieceType kingType = isPlayer1 ? PieceType::P1_KING : PieceType::P2_KING;
+	PieceType manType = isPlayer1 ? PieceType::P1_MAN : PieceType::P2_MAN;
+
+	// Solo se recorren las casillas ocupadas por las piezas del tipo buscado, extraidas de su mascara
+	Bitboard kings = gameBoard.GetPieceBitboard(kingType);
+	while (kings) {
+		int square = PopLowestBit(kings);
+		FindKingJumps(gameBoard, Board::SquareToRow(square), Board::SquareToCol(square), player, kingType, outMandatoryMoves);
 	}
-
-	if (!kingJumps.empty()) {
-		outMandatoryMoves = kingJumps;
+	if (!outMandatoryMoves.empty()) {
 		return MandatoryActionType::KING_CAPTURE;
 	}
-	if (!pawnJumps.empty()) {
-		outMandatoryMoves = pawnJumps;
+
+	Bitboard men = gameBoard.GetPieceBitboard(manType);
+	while (men) {
+		int square = PopLowestBit(men);
+		FindPawnJumps(gameBoard, Board::SquareToRow(square), Board::SquareToCol(square), player, manType, outMandatoryMoves);
+	}
+	if (!outMandatoryMoves.empty()) {
 		return MandatoryActionType::PAWN_CAPTURE;
 	}
 
@@ -198,11 +175,11 @@ bool MoveGenerator::IsValidMove(const Board& gameBoard, int startRow, int startC
 	if (pieceAtStart == PieceType::EMPTY) return false;
 	if (GetPlayerFromPiece(pieceAtStart) != player) return false;
 
-	std::vector<Move> mandatoryGlobalMoves;
+	MoveList mandatoryGlobalMoves;
 	MandatoryActionType requiredAction = GetMandatoryActionType(gameBoard, player, mandatoryGlobalMoves);
 
 	// Busca si el movimiento propuesto es uno de los posibles para la pieza
-	std::vector<Move> elementalMovesForPiece = GenerateMovesForPiece(gameBoard, startRow, startCol);
+	MoveList elementalMovesForPiece = GenerateMovesForPiece(gameBoard, startRow, startCol);
 
 	Move concreteProposedMove;
 	bool isElementalMove = false;
@@ -258,43 +235,250 @@ bool MoveGenerator::IsValidMove(const Board& gameBoard, int startRow, int startC
 	return false;
 }
 
-// Verifica si el jugador tiene al menos un movimiento legal disponible
-// Retorna true si existe al menos un movimiento permitido segun las reglas y la obligatoriedad
-// Si hay capturas obligatorias, solo se consideran esos movimientos
-// Si no hay capturas obligatorias, busca movimientos simples para cada pieza del jugador
+// Verifica si el jugador tiene al menos un movimiento legal disponible.
+// No hace falta saber cuales son: si hay capturas obligatorias tambien hay movimientos, asi que basta con
+// encontrar una pieza que pueda avanzar a una casilla vacia o saltar. Cada prueba es un desplazamiento de
+// mascaras y se devuelve true en la primera que encuentra alguna pieza.
 bool MoveGenerator::HasAnyValidMoves(const Board& gameBoard, PlayerColor player) const {
-	std::vector<Move> mandatoryMoves; // Almacena los movimientos obligatorios encontrados
-	MandatoryActionType actionType = GetMandatoryActionType(gameBoard, player, mandatoryMoves);
-
-	// Si hay capturas obligatorias (dama o peon), basta con que la lista no este vacia
-	if (actionType == MandatoryActionType::KING_CAPTURE || actionType == MandatoryActionType::PAWN_CAPTURE) {
-		return !mandatoryMoves.empty();
-	}
-
-	// Si no hay capturas obligatorias, buscar movimientos simples para cada pieza del jugador
-	if (actionType == MandatoryActionType::NONE) {
-		for (int r = 0; r < gameBoard.GetBoardSize(); ++r) {
-			for (int c = 0; c < gameBoard.GetBoardSize(); ++c) {
-				PieceType piece = gameBoard.GetPieceAt(r, c);
-				// Solo considerar piezas del jugador actual
-				if (GetPlayerFromPiece(piece) == player) {
-					std::vector<Move> simpleMovesForThisPiece; // Movimientos simples para la pieza actual
-					if (piece == PieceType::P1_MAN || piece == PieceType::P2_MAN) {
-						// Buscar movimientos simples de peon
-						FindSimplePawnMoves(gameBoard, r, c, player, piece, simpleMovesForThisPiece);
-					}
-					else if (piece == PieceType::P1_KING || piece == PieceType::P2_KING) {
-						// Buscar movimientos simples de dama
-						FindSimpleKingMoves(gameBoard, r, c, player, piece, simpleMovesForThisPiece);
-					}
-					// Si se encontro al menos un movimiento simple, el jugador puede mover
-					if (!simpleMovesForThisPiece.empty()) {
-						return true;
-					}
-				}
-			}
+	if (player == PlayerColor::NONE) {
+		return false;
+	}
+	bool isPlayer1 = (player == PlayerColor::PLAYER_1);
+	const Direction* forwardDirections = isPlayer1 ? P1_FORWARD_DIRECTIONS : P2_FORWARD_DIRECTIONS;
+	Bitboard men = gameBoard.GetPieceBitboard(isPlayer1 ? PieceType::P1_MAN : PieceType::P2_MAN);
+	Bitboard kings = gameBoard.GetPieceBitboard(isPlayer1 ? PieceType::P1_KING : PieceType::P2_KING);
+	Bitboard empty = gameBoard.GetEmptyBitboard();
+
+	// Movimientos simples (el caso mas frecuente): alguna pieza con una casilla vacia al lado
+	for (int i = 0; i < 2; ++i) {
+		if (men & ShiftBitboard(empty, OppositeDirection(forwardDirections[i]))) {
+			return true;
+		}
+	}
+	for (Direction dir : ALL_DIRECTIONS) {
+		if (kings & ShiftBitboard(empty, OppositeDirection(dir))) {
+			return true;
+		}
+	}
+	// Todas las piezas estan bloqueadas para avanzar; aun pueden moverse si alguna puede saltar
+	return HasAnyCapture(gameBoard, player);
+}
+
+// Verifica si alguna pieza del jugador puede saltar: vecina del oponente y la casilla siguiente vacia
+bool MoveGenerator::HasAnyCapture(const Board& gameBoard, PlayerColor player) const {
+	if (player == PlayerColor::NONE) {
+		return false;
+	}
+	bool isPlayer1 = (player == PlayerColor::PLAYER_1);
+	const Direction* forwardDirections = isPlayer1 ? P1_FORWARD_DIRECTIONS : P2_FORWARD_DIRECTIONS;
+	Bitboard men = gameBoard.GetPieceBitboard(isPlayer1 ? PieceType::P1_MAN : PieceType::P2_MAN);
+	Bitboard kings = gameBoard.GetPieceBitboard(isPlayer1 ? PieceType::P1_KING : PieceType::P2_KING);
+	Bitboard opponents = gameBoard.GetPlayerBitboard(isPlayer1 ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1);
+	Bitboard empty = gameBoard.GetEmptyBitboard();
+
+	for (int i = 0; i < 2; ++i) {
+		Direction back = OppositeDirection(forwardDirections[i]);
+		if (men & ShiftBitboard(opponents & ShiftBitboard(empty, back), back)) {
+			return true;
+		}
+	}
+	for (Direction dir : ALL_DIRECTIONS) {
+		Direction back = OppositeDirection(dir);
+		if (kings & ShiftBitboard(opponents & ShiftBitboard(empty, back), back)) {
+			return true;
 		}
 	}
-	// Si no se encontro ningun movimiento valido, retorna false
 	return false;
-}
\ No newline at end of file
+}
+
+// Agrega los saltos en la direccion 'dir' de todas las piezas de 'movers'.
+// Una pieza puede saltar si su vecina en 'dir' es del oponente y la casilla siguiente esta vacia;
+// ese conjunto se obtiene desplazando las mascaras en la direccion opuesta, sin recorrer casillas.
+void MoveGenerator::AddBitboardJumps(Bitboard movers, Direction dir, Bitboard opponents, Bitboard empty, PieceType piece, PlayerColor player, MoveList& moves) const {
+	Direction back = OppositeDirection(dir);
+	Bitboard jumpers = movers & ShiftBitboard(opponents & ShiftBitboard(empty, back), back);
+	while (jumpers) {
+		int from = PopLowestBit(jumpers);
+		int to = JumpSquare(from, dir);
+		moves.push_back({ Board::SquareToRow(from), Board::SquareToCol(from), Board::SquareToRow(to), Board::SquareToCol(to), piece, player, true });
+	}
+}
+
+// Agrega los movimientos simples en la direccion 'dir' de todas las piezas de 'movers'
+void MoveGenerator::AddBitboardSimpleMoves(Bitboard movers, Direction dir, Bitboard empty, PieceType piece, PlayerColor player, MoveList& moves) const {
+	Bitboard canMove = movers & ShiftBitboard(empty, OppositeDirection(dir));
+	while (canMove) {
+		int from = PopLowestBit(canMove);
+		int to = NeighborSquare(from, dir);
+		moves.push_back({ Board::SquareToRow(from), Board::SquareToCol(from), Board::SquareToRow(to), Board::SquareToCol(to), piece, player, false });
+	}
+}
+
+// Genera el conjunto completo de movimientos legales de un jugador con el backend de bitboards.
+// Aplica las mismas reglas que GetMandatoryActionType: si alguna Dama puede capturar solo se permiten
+// capturas de Dama; si no, si algun peon puede capturar solo se permiten capturas de peon;
+// en otro caso se generan los movimientos simples.
+MandatoryActionType MoveGenerator::GenerateLegalMoves(const Board& gameBoard, PlayerColor player, MoveList& outMoves) const {
+	outMoves.clear();
+	if (player == PlayerColor::NONE) {
+		return MandatoryActionType::NONE;
+	}
+
+	bool isPlayer1 = (player == PlayerColor::PLAYER_1);
+	PieceType manType = isPlayer1 ? PieceType::P1_MAN : PieceType::P2_MAN;
+	PieceType kingType = isPlayer1 ? PieceType::P1_KING : PieceType::P2_KING;
+	const Direction* forwardDirections = isPlayer1 ? P1_FORWARD_DIRECTIONS : P2_FORWARD_DIRECTIONS;
+
+	Bitboard men = gameBoard.GetPieceBitboard(manType);
+	Bitboard kings = gameBoard.GetPieceBitboard(kingType);
+	Bitboard opponents = gameBoard.GetPlayerBitboard(isPlayer1 ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1);
+	Bitboard empty = gameBoard.GetEmptyBitboard();
+
+	// 1. Capturas de Dama (prioridad maxima)
+	for (Direction dir : ALL_DIRECTIONS) {
+		AddBitboardJumps(kings, dir, opponents, empty, kingType, player, outMoves);
+	}
+	if (!outMoves.empty()) {
+		return MandatoryActionType::KING_CAPTURE;
+	}
+
+	// 2. Capturas de peon (solo hacia adelante)
+	for (int i = 0; i < 2; ++i) {
+		AddBitboardJumps(men, forwardDirections[i], opponents, empty, manType, player, outMoves);
+	}
+	if (!outMoves.empty()) {
+		return MandatoryActionType::PAWN_CAPTURE;
+	}
+
+	// 3. Movimientos simples
+	for (int i = 0; i < 2; ++i) {
+		AddBitboardSimpleMoves(men, forwardDirections[i], empty, manType, player, outMoves);
+	}
+	for (Direction dir : ALL_DIRECTIONS) {
+		AddBitboardSimpleMoves(kings, dir, empty, kingType, player, outMoves);
+	}
+	return MandatoryActionType::NONE;
+}
+
+// Genera los movimientos completos del turno: cadenas de captura enteras o movimientos simples
+MandatoryActionType MoveGenerator::GenerateMoveSequences(const Board& gameBoard, PlayerColor player, MoveSequenceList& outSequences) const {
+	outSequences.clear();
+	if (player == PlayerColor::NONE) {
+		return MandatoryActionType::NONE;
+	}
+
+	bool isPlayer1 = (player == PlayerColor::PLAYER_1);
+	const Direction* forwardDirections = isPlayer1 ? P1_FORWARD_DIRECTIONS : P2_FORWARD_DIRECTIONS;
+	Bitboard men = gameBoard.GetPieceBitboard(isPlayer1 ? PieceType::P1_MAN : PieceType::P2_MAN);
+	Bitboard kings = gameBoard.GetPieceBitboard(isPlayer1 ? PieceType::P1_KING : PieceType::P2_KING);
+	Bitboard opponents = gameBoard.GetPlayerBitboard(isPlayer1 ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1);
+	Bitboard empty = gameBoard.GetEmptyBitboard();
+
+	// Piezas que pueden empezar una cadena (el primer salto respeta la prioridad de la Dama)
+	Bitboard kingJumpers = 0;
+	for (Direction dir : ALL_DIRECTIONS) {
+		Direction back = OppositeDirection(dir);
+		kingJumpers |= kings & ShiftBitboard(opponents & ShiftBitboard(empty, back), back);
+	}
+	if (kingJumpers) {
+		while (kingJumpers) {
+			AppendCaptureSequencesFromSquare(gameBoard, PopLowestBit(kingJumpers), outSequences);
+		}
+		return MandatoryActionType::KING_CAPTURE;
+	}
+
+	Bitboard pawnJumpers = 0;
+	for (int i = 0; i < 2; ++i) {
+		Direction back = OppositeDirection(forwardDirections[i]);
+		pawnJumpers |= men & ShiftBitboard(opponents & ShiftBitboard(empty, back), back);
+	}
+	if (pawnJumpers) {
+		while (pawnJumpers) {
+			AppendCaptureSequencesFromSquare(gameBoard, PopLowestBit(pawnJumpers), outSequences);
+		}
+		return MandatoryActionType::PAWN_CAPTURE;
+	}
+
+	// Sin capturas: cada movimiento simple es una secuencia de un paso
+	MoveList simpleMoves;
+	GenerateLegalMoves(gameBoard, player, simpleMoves);
+	for (const Move& move : simpleMoves) {
+		outSequences.push_back(MoveSequence::FromMove(move));
+	}
+	return MandatoryActionType::NONE;
+}
+
+// Genera las cadenas de captura completas de una pieza concreta
+void MoveGenerator::GenerateCaptureSequencesForPiece(const Board& gameBoard, int pieceRow, int pieceCol, MoveSequenceList& outSequences) const {
+	outSequences.clear();
+	int square = Board::ToSquareIndex(pieceRow, pieceCol);
+	if (square < 0 || gameBoard.GetPieceAtSquare(square) == PieceType::EMPTY) {
+		return;
+	}
+	AppendCaptureSequencesFromSquare(gameBoard, square, outSequences);
+}
+
+// Prepara la secuencia inicial de la pieza en 'square' y la extiende con todos sus saltos
+void MoveGenerator::AppendCaptureSequencesFromSquare(const Board& gameBoard, int square, MoveSequenceList& outSequences) const {
+	PieceType piece = gameBoard.GetPieceAtSquare(square);
+	PlayerColor player = GetPlayerFromPiece(piece);
+	PlayerColor opponent = (player == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+
+	MoveSequence sequence;
+	sequence.startSquare_ = square;
+	sequence.pieceMoved_ = piece;
+	sequence.playerColor_ = player;
+	sequence.isCapture_ = true;
+
+	bool isKing = (piece == PieceType::P1_KING || piece == PieceType::P2_KING);
+	ExtendCaptureSequence(sequence, square, isKing, gameBoard.GetPlayerBitboard(opponent), gameBoard.GetEmptyBitboard(), outSequences);
+}
+
+// Extiende la cadena con cada salto posible desde 'square'.
+// Reproduce el juego salto a salto de GameManager: la pieza capturada se retira en cuanto se salta,
+// la casilla de origen queda libre y un peon que corona a mitad de cadena continua como Dama.
+void MoveGenerator::ExtendCaptureSequence(MoveSequence& sequence, int square, bool isKing, Bitboard opponents, Bitboard empty, MoveSequenceList& outSequences) const {
+	bool isPlayer1 = (sequence.playerColor_ == PlayerColor::PLAYER_1);
+	const Direction* directions = isKing ? ALL_DIRECTIONS : (isPlayer1 ? P1_FORWARD_DIRECTIONS : P2_FORWARD_DIRECTIONS);
+	int numDirections = isKing ? 4 : 2;
+	Bitboard promotionRow = isPlayer1 ? BITBOARD_ROW_0 : BITBOARD_ROW_7;
+
+	bool extended = false;
+	if (sequence.numSteps_ < MoveSequence::MAX_STEPS) {
+		for (int i = 0; i < numDirections; ++i) {
+			int landing = JumpSquare(square, directions[i]);
+			if (landing == NO_SQUARE || !(empty & SquareBit(landing))) continue;
+			int captured = NeighborSquare(square, directions[i]);
+			if (!(opponents & SquareBit(captured))) continue;
+
+			int step = sequence.numSteps_;
+			sequence.landingSquares_[step] = static_cast<std::int8_t>(landing);
+			sequence.capturedSquares_[step] = static_cast<std::int8_t>(captured);
+			sequence.numSteps_++;
+			bool promotes = !isKing && (promotionRow & SquareBit(landing));
+			if (promotes) {
+				sequence.promotionStep_ = step;
+			}
+
+			Bitboard emptyAfterJump = (empty | SquareBit(square) | SquareBit(captured)) & ~SquareBit(landing);
+			ExtendCaptureSequence(sequence, landing, isKing || promotes, opponents & ~SquareBit(captured), emptyAfterJump, outSequences);
+
+			sequence.numSteps_--;
+			if (promotes) {
+				sequence.promotionStep_ = -1;
+			}
+			extended = true;
+		}
+	}
+
+	// Fin de la cadena: no quedan saltos para la pieza
+	if (!extended && sequence.numSteps_ > 0) {
+		// La cantidad de cadenas no tiene una cota demostrada (ver MoveSequenceList). Si la lista se llenara,
+		// se aborta en cualquier compilacion: descartar la cadena perderia una jugada legal y el assert de
+		// push_back no existe con NDEBUG.
+		if (outSequences.full()) {
+			std::abort();
+		}
+		outSequences.push_back(sequence);
+	}
+}
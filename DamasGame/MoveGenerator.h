@@ -1,8 +1,10 @@
 #ifndef MOVE_GENERATOR_H
 #define MOVE_GENERATOR_H
 
-#include "CommonTypes.h" // Para Move, PlayerColor, PieceType, std::vector
+#include "CommonTypes.h" // Para Move, PlayerColor, PieceType
 #include "Board.h"       // Para const Board&
+#include "MoveList.h"    // Para MoveList (lista de capacidad fija)
+#include "MoveSequence.h" // Para MoveSequence y MoveSequenceList
 
 // Enum para definir el tipo de accion que es obligatoria para el jugador actual.
 enum class MandatoryActionType {
@@ -16,11 +18,12 @@ class MoveGenerator {
 public:
 	MoveGenerator();
 
-	std::vector<Move> GenerateMovesForPiece(const Board& gameBoard,
+	// Genera los movimientos de una pieza (solo sus saltos si puede capturar)
+	MoveList GenerateMovesForPiece(const Board& gameBoard,
 		int startRow, int startCol) const;
 
 	// Genera SOLO los movimientos de salto (captura) posibles para una pieza espec�fica.
-	std::vector<Move> GetPossibleJumpsForSpecificPiece(const Board& gameBoard,
+	MoveList GetPossibleJumpsForSpecificPiece(const Board& gameBoard,
 		int pieceRow, int pieceCol) const;
 
 	// Valida si un movimiento propuesto (de start a end) es legal para el jugador dado,
@@ -30,21 +33,52 @@ public:
 		PlayerColor player,
 		bool& wasCapture) const;
 
-	// Verifica si el jugador dado tiene algun movimiento legal disponible,
+	// Verifica si el jugador dado tiene algun movimiento legal disponible, con pruebas de movilidad sobre
+	// los bitboards que terminan en la primera direccion en la que alguna pieza puede mover
 	bool HasAnyValidMoves(const Board& gameBoard, PlayerColor player) const;
 
+	// Verifica si el jugador dado tiene alguna captura (y por lo tanto esta obligado a capturar),
+	// sin generar los saltos
+	bool HasAnyCapture(const Board& gameBoard, PlayerColor player) const;
+
 	// Determina el tipo de accion obligatoria (NINGUNA, CAPTURA_DAMA, CAPTURA_PEON)
-	MandatoryActionType GetMandatoryActionType(const Board& gameBoard, PlayerColor player, std::vector<Move>& outMandatoryMoves) const;
+	MandatoryActionType GetMandatoryActionType(const Board& gameBoard, PlayerColor player, MoveList& outMandatoryMoves) const;
 
 	// Helper para obtener el PlayerColor de una PieceType 
 	PlayerColor GetPlayerFromPiece(PieceType piece) const;
 
+	// --- Backend de bitboards ---
+	// Genera todos los movimientos legales del jugador (captura obligatoria y prioridad de la Dama incluidas)
+	// con desplazamientos y mascaras sobre los bitboards, escribiendo en una lista del llamador.
+	// Devuelve el tipo de accion obligatoria que determino el conjunto generado.
+	MandatoryActionType GenerateLegalMoves(const Board& gameBoard, PlayerColor player, MoveList& outMoves) const;
+
+	// --- Secuencias completas (movimientos atomicos) ---
+	// Genera todos los movimientos completos del turno: las cadenas de captura enteras (con la prioridad
+	// de captura de Dama) o, si no hay capturas, los movimientos simples como secuencias de un paso.
+	MandatoryActionType GenerateMoveSequences(const Board& gameBoard, PlayerColor player, MoveSequenceList& outSequences) const;
+
+	// Genera las cadenas de captura completas que parten de una pieza concreta
+	// (por ejemplo, para continuar una secuencia de capturas ya empezada).
+	void GenerateCaptureSequencesForPiece(const Board& gameBoard, int pieceRow, int pieceCol, MoveSequenceList& outSequences) const;
+
 private:
 	// Funciones helper para encontrar tipos especificos de movimientos para una pieza.
-	void FindSimplePawnMoves(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, std::vector<Move>& moves) const;
-	void FindPawnJumps(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, std::vector<Move>& moves) const;
-	void FindSimpleKingMoves(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, std::vector<Move>& moves) const;
-	void FindKingJumps(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, std::vector<Move>& moves) const;
+	void FindSimplePawnMoves(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, MoveList& moves) const;
+	void FindPawnJumps(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, MoveList& moves) const;
+	void FindSimpleKingMoves(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, MoveList& moves) const;
+	void FindKingJumps(const Board& gameBoard, int r, int c, PlayerColor player, PieceType piece, MoveList& moves) const;
+
+	// Helpers del backend de bitboards: agregan los saltos o movimientos simples en una direccion
+	// de todas las piezas presentes en la mascara 'movers'.
+	void AddBitboardJumps(Bitboard movers, Direction dir, Bitboard opponents, Bitboard empty, PieceType piece, PlayerColor player, MoveList& moves) const;
+	void AddBitboardSimpleMoves(Bitboard movers, Direction dir, Bitboard empty, PieceType piece, PlayerColor player, MoveList& moves) const;
+
+	// Agrega todas las cadenas de captura que empiezan en la pieza de 'square'
+	void AppendCaptureSequencesFromSquare(const Board& gameBoard, int square, MoveSequenceList& outSequences) const;
+	// Extiende recursivamente una cadena de capturas desde 'square'; cuando ya no hay saltos la agrega a la lista.
+	// 'opponents' y 'empty' reflejan el tablero tras los saltos ya realizados (piezas capturadas retiradas).
+	void ExtendCaptureSequence(MoveSequence& sequence, int square, bool isKing, Bitboard opponents, Bitboard empty, MoveSequenceList& outSequences) const;
 };
 
 #endif // MOVE_GENERATOR_H
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef MOVE_LIST_H
+#define MOVE_LIST_H
+
+#include "CommonTypes.h" // Para Move
+
+#include <array>
+#include <cassert>
+
+// Lista de capacidad fija con almacenamiento en linea.
+// Vive en la pila del llamador, por lo que llenarla no reserva memoria dinamica.
+template <typename T, int Capacity>
+class FixedCapacityList {
+public:
+	static constexpr int MAX_SIZE = Capacity;
+
+	FixedCapacityList() : mCount(0) {}
+
+	// Agrega un elemento al final de la lista (la lista no debe estar llena)
+	void push_back(const T& item) {
+		assert(mCount < Capacity);
+		mItems[mCount++] = item;
+	}
+
+	// Quita el ultimo elemento (la lista no debe estar vacia)
+	void pop_back() {
+		assert(mCount > 0);
+		--mCount;
+	}
+
+	// Vacia la lista sin liberar memoria
+	void clear() { mCount = 0; }
+
+	int size() const { return mCount; }
+	bool empty() const { return mCount == 0; }
+	bool full() const { return mCount == Capacity; }
+
+	const T& operator[](int index) const { return mItems[index]; }
+	T& operator[](int index) { return mItems[index]; }
+	const T& front() const { return mItems[0]; }
+	const T& back() const { return mItems[mCount - 1]; }
+
+	// Iteradores para poder usar la lista en bucles for de rango
+	const T* begin() const { return mItems.data(); }
+	const T* end() const { return mItems.data() + mCount; }
+	T* begin() { return mItems.data(); }
+	T* end() { return mItems.data() + mCount; }
+
+private:
+	std::array<T, Capacity> mItems; // Almacenamiento en linea de los elementos
+	int mCount;                     // Cantidad de elementos validos en la lista
+};
+
+// Lista de movimientos elementales. Es el tipo que usa toda la interfaz de MoveGenerator, asi que
+// generar y validar movimientos no reserva memoria dinamica.
+// Capacidad maxima: 12 piezas x 4 direcciones = 48 movimientos elementales como maximo
+using MoveList = FixedCapacityList<Move, 64>;
+
+#endif // MOVE_LIST_H
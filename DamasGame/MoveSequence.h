@@ -0,0 +1,90 @@
+#ifndef MOVE_SEQUENCE_H
+#define MOVE_SEQUENCE_H
+
+#include "CommonTypes.h" // Para Move, PieceType, PlayerColor
+#include "Board.h"       // Para la conversion entre casillas y coordenadas
+#include "Bitboard.h"    // Para Bitboard
+#include "CompactMove.h" // Para CompactMove
+#include "MoveList.h"    // Para FixedCapacityList
+
+#include <cstdint>
+
+// Movimiento atomico completo de un turno.
+// Un movimiento simple es una secuencia de un paso sin captura; una cadena de capturas
+// guarda todas sus casillas de aterrizaje y las casillas de las piezas capturadas en orden.
+// Las casillas son indices de casilla jugable (0..31), ver Board::ToSquareIndex.
+struct MoveSequence {
+	// Una cadena no puede capturar mas piezas de las que tiene el oponente (12)
+	static constexpr int MAX_STEPS = 12;
+
+	int startSquare_ = -1; // Casilla de inicio de la pieza
+	int numSteps_ = 0;     // Cantidad de pasos (saltos) de la secuencia
+	std::int8_t landingSquares_[MAX_STEPS] = {};  // Casilla de aterrizaje de cada paso
+	std::int8_t capturedSquares_[MAX_STEPS] = {}; // Casilla capturada en cada paso (-1 si no hay captura)
+	int promotionStep_ = -1; // Paso tras el cual la pieza corona (-1 si no corona)
+	PieceType pieceMoved_ = PieceType::EMPTY;      // Pieza al inicio de la secuencia
+	PlayerColor playerColor_ = PlayerColor::NONE;  // Jugador que realiza el movimiento
+	bool isCapture_ = false; // Indica si la secuencia es una cadena de capturas
+
+	bool IsNull() const { return numSteps_ == 0; }
+
+	// Casilla donde termina la pieza
+	int GetEndSquare() const { return landingSquares_[numSteps_ - 1]; }
+
+	// Mascara con todas las casillas capturadas por la secuencia
+	Bitboard GetCapturedMask() const {
+		Bitboard mask = 0;
+		if (isCapture_) {
+			for (int i = 0; i < numSteps_; ++i) {
+				mask |= SquareBit(capturedSquares_[i]);
+			}
+		}
+		return mask;
+	}
+
+	// Devuelve el paso 'step' empaquetado, sin pasar por filas y columnas (lo usa la busqueda)
+	CompactMove GetCompactStep(int step) const {
+		int from = (step == 0) ? startSquare_ : landingSquares_[step - 1];
+		PieceType piece = pieceMoved_;
+		// Si la pieza corono en un paso anterior, continua la cadena como Dama
+		if (promotionStep_ >= 0 && step > promotionStep_) {
+			piece = (playerColor_ == PlayerColor::PLAYER_1) ? PieceType::P1_KING : PieceType::P2_KING;
+		}
+		return CompactMove(from, landingSquares_[step], isCapture_ ? capturedSquares_[step] : -1,
+			step == promotionStep_, piece, playerColor_);
+	}
+
+	// Devuelve el paso 'step' como movimiento elemental (el que se juega salto a salto en GameManager)
+	Move GetStep(int step) const {
+		return GetCompactStep(step).ToMove();
+	}
+
+	// Construye una secuencia de un solo paso a partir de un movimiento elemental
+	static MoveSequence FromMove(const Move& move) {
+		MoveSequence sequence;
+		sequence.startSquare_ = Board::ToSquareIndex(move.startR_, move.startC_);
+		sequence.numSteps_ = 1;
+		sequence.landingSquares_[0] = static_cast<std::int8_t>(Board::ToSquareIndex(move.endR_, move.endC_));
+		sequence.capturedSquares_[0] = static_cast<std::int8_t>(move.isCapture_
+			? Board::ToSquareIndex((move.startR_ + move.endR_) / 2, (move.startC_ + move.endC_) / 2)
+			: -1);
+		sequence.pieceMoved_ = move.pieceMoved_;
+		sequence.playerColor_ = move.playerColor_;
+		sequence.isCapture_ = move.isCapture_;
+		if ((move.pieceMoved_ == PieceType::P1_MAN && move.endR_ == 0) ||
+			(move.pieceMoved_ == PieceType::P2_MAN && move.endR_ == Board::BOARD_SIZE - 1)) {
+			sequence.promotionStep_ = 0;
+		}
+		return sequence;
+	}
+};
+
+// Lista de secuencias completas de un turno.
+// Los movimientos simples siempre caben: vienen de una MoveList (12 piezas con 4 direcciones como mucho).
+// Para las cadenas de captura no hay una cota demostrada; buscando posiciones con muchas cadenas no se pasa
+// de unas 34, asi que 128 deja margen. La generacion nunca descarta una cadena: si la lista se llenara,
+// MoveGenerator aborta el programa, tambien en las compilaciones sin asserts.
+using MoveSequenceList = FixedCapacityList<MoveSequence, 128>;
+static_assert(MoveSequenceList::MAX_SIZE >= MoveList::MAX_SIZE, "MoveSequenceList debe admitir todos los movimientos simples");
+
+#endif // MOVE_SEQUENCE_H
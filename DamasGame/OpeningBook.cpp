@@ -0,0 +1,75 @@
+#include "OpeningBook.h"
+
+#include <cstring> // Para std::memcmp
+
+// Constructor de OpeningBook: sin libro cargado
+OpeningBook::OpeningBook()
+	: mFile(),
+	mEntryCount(0),
+	mMaxTurns(0) {
+}
+
+// Proyecta el archivo y comprueba la cabecera. Las entradas no se leen: ya estan ordenadas en disco.
+bool OpeningBook::Load(const std::string& path) {
+	Unload();
+	if (!mFile.Open(path)) {
+		return false;
+	}
+	const unsigned char* data = mFile.GetData();
+	std::size_t size = mFile.GetSize();
+	if (size < static_cast<std::size_t>(HEADER_SIZE) || std::memcmp(data, FILE_MAGIC, 8) != 0) {
+		Unload();
+		return false;
+	}
+	std::uint32_t entryCount = ReadUint32(data + 8);
+	if (size != HEADER_SIZE + static_cast<std::uint64_t>(entryCount) * ENTRY_SIZE) {
+		Unload();
+		return false;
+	}
+	mEntryCount = entryCount;
+	mMaxTurns = ReadUint32(data + 12);
+	return true;
+}
+
+void OpeningBook::Unload() {
+	mFile.Close();
+	mEntryCount = 0;
+	mMaxTurns = 0;
+}
+
+std::uint64_t OpeningBook::KeyAt(std::uint32_t index) const {
+	return ReadUint64(mFile.GetData() + HEADER_SIZE + static_cast<std::size_t>(index) * ENTRY_SIZE);
+}
+
+// Busqueda binaria de la primera entrada con la clave; los movimientos de la posicion son contiguos
+int OpeningBook::Lookup(std::uint64_t key, BookMoveStats* outMoves, int maxMoves) const {
+	std::uint32_t low = 0;
+	std::uint32_t high = mEntryCount;
+	while (low < high) {
+		std::uint32_t middle = low + (high - low) / 2;
+		if (KeyAt(middle) < key) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+
+	int count = 0;
+	for (std::uint32_t index = low; index < mEntryCount && count < maxMoves && KeyAt(index) == key; ++index) {
+		const unsigned char* entry = mFile.GetData() + HEADER_SIZE + static_cast<std::size_t>(index) * ENTRY_SIZE;
+		BookMoveStats& stats = outMoves[count++];
+		stats.move = ReadUint64(entry + 8);
+		stats.games = ReadUint32(entry + 16);
+		stats.wins = ReadUint32(entry + 20);
+		stats.draws = ReadUint32(entry + 24);
+	}
+	return count;
+}
+
+std::uint64_t OpeningBook::EncodeMove(const MoveSequence& move) {
+	return static_cast<std::uint64_t>(move.startSquare_) |
+		(static_cast<std::uint64_t>(move.GetEndSquare()) << 5) |
+		(static_cast<std::uint64_t>(move.promotionStep_ >= 0 ? 1 : 0) << 10) |
+		(static_cast<std::uint64_t>(move.GetCapturedMask()) << 11);
+}
@@ -0,0 +1,64 @@
+#ifndef OPENING_BOOK_H
+#define OPENING_BOOK_H
+
+#include "MappedFile.h"   // Para proyectar el archivo del libro en memoria y leer sus enteros
+#include "MoveSequence.h" // Para codificar los movimientos completos
+
+#include <cstdint>
+#include <string>
+
+// Estadisticas de un movimiento del libro, vistas desde el bando que lo juega
+struct BookMoveStats {
+	std::uint64_t move = 0;  // Codigo del movimiento completo (OpeningBook::EncodeMove)
+	std::uint32_t games = 0; // Partidas en las que se jugo desde esta posicion
+	std::uint32_t wins = 0;  // Partidas que gano el bando que lo jugo
+	std::uint32_t draws = 0; // Partidas empatadas
+};
+
+// Libro de aperturas: movimientos jugados en auto-juego desde cada posicion de los primeros turnos,
+// con sus resultados. Lo genera la herramienta BookBuilder a partir de las partidas grabadas con SelfPlay.
+// Las entradas estan ordenadas por clave Zobrist (que incluye el bando que mueve) y por movimiento,
+// asi que cargar el libro es proyectar el archivo y consultar una posicion es una busqueda binaria.
+// Las claves Zobrist se generan con una semilla fija, de modo que el archivo sirve entre compilaciones.
+//
+// Formato del archivo (enteros little-endian):
+//   cabecera: "DAMASBK2" (8 bytes), cantidad de entradas (uint32), turnos cubiertos por el libro (uint32)
+//   entradas: clave (uint64), movimiento (uint64), partidas, victorias y empates (uint32 cada uno)
+class OpeningBook {
+public:
+	static constexpr const char* DEFAULT_FILENAME = "damas_book.bin";
+
+	static constexpr char FILE_MAGIC[9] = "DAMASBK2";
+	static constexpr int HEADER_SIZE = 16;
+	static constexpr int ENTRY_SIZE = 28;
+
+	OpeningBook();
+
+	// Proyecta un archivo de libro. Devuelve false (sin libro cargado) si falta o no es valido.
+	bool Load(const std::string& path);
+	void Unload();
+	bool IsLoaded() const { return mFile.IsOpen(); }
+	// Cantidad de pares posicion-movimiento del libro
+	std::uint32_t GetEntryCount() const { return mEntryCount; }
+	// Turnos desde la posicion inicial que cubre el libro
+	std::uint32_t GetMaxTurns() const { return mMaxTurns; }
+
+	// Movimientos del libro para la posicion con clave 'key' (Board::GetHashKey con el bando que mueve).
+	// Copia hasta 'maxMoves' en 'outMoves' y devuelve cuantos se copiaron (0 si la posicion no esta).
+	int Lookup(std::uint64_t key, BookMoveStats* outMoves, int maxMoves) const;
+
+	// Codigo con el que el libro identifica un movimiento completo: casilla de salida (bits 0-4), de llegada
+	// (bits 5-9), coronacion (bit 10) y mascara de casillas capturadas (bits 11-42). Dos movimientos con el
+	// mismo codigo dejan el mismo tablero. El codigo de 16 bits de la tabla de transposicion no sirve aqui:
+	// no distingue dos cadenas con la misma salida, primer aterrizaje y llegada que capturan piezas distintas.
+	static std::uint64_t EncodeMove(const MoveSequence& move);
+
+private:
+	MappedFile mFile;          // Archivo del libro proyectado
+	std::uint32_t mEntryCount; // Entradas del libro (0 sin libro)
+	std::uint32_t mMaxTurns;   // Turnos cubiertos por el libro
+
+	std::uint64_t KeyAt(std::uint32_t index) const;
+};
+
+#endif // OPENING_BOOK_H
@@ -25,15 +25,13 @@ public:
 	// moveGenerator: referencia al generador de movimientos
 	// isInCaptureSequence: indica si el jugador esta en una secuencia de capturas
 	// forcedRow, forcedCol: posicion desde donde debe continuar la captura (si aplica)
-	// availableMandatoryJumps: lista de movimientos de captura obligatorios
 	// Retorna un MoveInput con la jugada elegida
 	virtual MoveInput GetChosenMoveInput(
 		const Board& board,
 		const MoveGenerator& moveGenerator,
 		bool isInCaptureSequence,
 		int forcedRow,
-		int forcedCol,
-		const std::vector<Move>& availableMandatoryJumps
+		int forcedCol
 	) = 0;
 
 protected:
@@ -0,0 +1,510 @@
+#include "SearchEngine.h"
+#include "Board.h"
+#include "CommonTypes.h"
+
+#include <memory> // Para std::unique_ptr de los motores auxiliares
+#include <thread> // Para los hilos auxiliares de Lazy SMP
+#include <vector>
+
+// Constructor de SearchEngine
+SearchEngine::SearchEngine(const MoveGenerator& moveGenerator, TranspositionTable* transpositionTable)
+	: mMoveGenerator(moveGenerator),
+	mEvaluator(),
+	mTranspositionTable(transpositionTable),
+	mTablebase(nullptr),
+	mNodes(0),
+	mMaxNodes(0),
+	mStopped(false),
+	mStopSignal(nullptr),
+	mHasDeadline(false),
+	mDeadline(),
+	mHasSoftDeadline(false),
+	mSoftDeadline(),
+	mKillers(),
+	mHistory(),
+	mBetaCutoffs(0),
+	mFirstMoveCutoffs(0),
+	mQuiescenceNodes(0),
+	mQuiescenceEnabled(true),
+	mTablebaseHits(0) {
+}
+
+// Busqueda del mejor movimiento. Con un solo hilo se hace la profundizacion iterativa en el hilo llamador.
+// Con varios hilos (Lazy SMP) se lanzan hilos auxiliares sobre copias del tablero que comparten la
+// tabla de transposicion y se detienen cuando termina el hilo principal.
+SearchResult SearchEngine::Search(Board& board, PlayerColor sideToMove, const MoveSequenceList& rootMoves, const SearchLimits& limits) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	if (mTranspositionTable) {
+		mTranspositionTable->NewSearch();
+	}
+	if (rootMoves.empty()) {
+		return SearchResult();
+	}
+	SearchResult tablebaseResult;
+	if (mTablebase && SearchTablebaseRoot(board, sideToMove, rootMoves, tablebaseResult)) {
+		tablebaseResult.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		return tablebaseResult;
+	}
+
+	// Sin tabla compartida los hilos no se ayudan entre si: se busca con un solo hilo
+	int helperCount = (mTranspositionTable && limits.threads > 1) ? limits.threads - 1 : 0;
+	if (helperCount == 0) {
+		PrepareSearch(limits, start, nullptr);
+		SearchResult result = IterativeDeepening(board, sideToMove, rootMoves, limits, 1);
+		result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		return result;
+	}
+
+	std::atomic<bool> stopSignal(false);
+	PrepareSearch(limits, start, &stopSignal);
+
+	std::vector<std::unique_ptr<SearchEngine>> helpers;
+	std::vector<Board> helperBoards(helperCount, board);
+	std::vector<SearchResult> helperResults(helperCount);
+	std::vector<std::thread> helperThreads;
+	for (int helper = 0; helper < helperCount; ++helper) {
+		helpers.emplace_back(new SearchEngine(mMoveGenerator, mTranspositionTable));
+		helpers[helper]->SetTablebase(mTablebase);
+		helpers[helper]->PrepareSearch(limits, start, &stopSignal);
+	}
+	for (int helper = 0; helper < helperCount; ++helper) {
+		helperThreads.emplace_back([&, helper]() {
+			// Cada auxiliar empieza la raiz por otro movimiento y la mitad se salta la profundidad 1,
+			// asi los hilos no recorren el arbol en el mismo orden
+			int threadId = helper + 1;
+			MoveSequenceList helperMoves;
+			for (int i = 0; i < rootMoves.size(); ++i) {
+				helperMoves.push_back(rootMoves[(i + threadId) % rootMoves.size()]);
+			}
+			helperResults[helper] = helpers[helper]->IterativeDeepening(helperBoards[helper], sideToMove, helperMoves, limits, 1 + threadId % 2);
+		});
+	}
+
+	SearchResult result = IterativeDeepening(board, sideToMove, rootMoves, limits, 1);
+	stopSignal.store(true, std::memory_order_relaxed);
+	for (std::thread& thread : helperThreads) {
+		thread.join();
+	}
+
+	for (const SearchResult& helperResult : helperResults) {
+		result.nodes += helperResult.nodes;
+		result.betaCutoffs += helperResult.betaCutoffs;
+		result.firstMoveCutoffs += helperResult.firstMoveCutoffs;
+		result.quiescenceNodes += helperResult.quiescenceNodes;
+		result.tablebaseHits += helperResult.tablebaseHits;
+		if (helperResult.depthReached > result.depthReached) {
+			result.bestMove = helperResult.bestMove;
+			result.score = helperResult.score;
+			result.depthReached = helperResult.depthReached;
+		}
+	}
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+void SearchEngine::PrepareSearch(const SearchLimits& limits, std::chrono::steady_clock::time_point start, std::atomic<bool>* stopSignal) {
+	mNodes = 0;
+	mMaxNodes = limits.maxNodes;
+	mStopped = false;
+	mStopSignal = stopSignal;
+	mHasDeadline = (limits.maxTimeMs > 0);
+	mDeadline = start + std::chrono::milliseconds(limits.maxTimeMs);
+	mHasSoftDeadline = (limits.softTimeMs > 0);
+	mSoftDeadline = start + std::chrono::milliseconds(limits.softTimeMs);
+	mBetaCutoffs = 0;
+	mFirstMoveCutoffs = 0;
+	mQuiescenceNodes = 0;
+	mQuiescenceEnabled = limits.quiescence;
+	mTablebaseHits = 0;
+	ResetMoveOrdering();
+}
+
+bool SearchEngine::IsStopRequested() const {
+	if (mStopSignal && mStopSignal->load(std::memory_order_relaxed)) {
+		return true;
+	}
+	return mHasDeadline && std::chrono::steady_clock::now() >= mDeadline;
+}
+
+// Profundizacion iterativa: busca a profundidad firstDepth, firstDepth + 1, ... hasta 'limits.maxDepth'.
+// El mejor movimiento de cada iteracion se prueba primero en la siguiente, lo que mejora la poda.
+// Termina al llegar a la profundidad maxima, al pasar el limite blando de tiempo entre iteraciones
+// o al cortarse la busqueda. En una iteracion cortada solo se aprovecha un movimiento que haya superado
+// al mejor de la iteracion anterior (que se busca primero); el resto de la iteracion no es fiable.
+SearchResult SearchEngine::IterativeDeepening(Board& board, PlayerColor sideToMove, const MoveSequenceList& rootMoves, const SearchLimits& limits, int firstDepth) {
+	SearchResult result;
+	result.bestMove = rootMoves[0];
+
+	PlayerColor opponent = (sideToMove == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+	MoveSequenceList orderedMoves = rootMoves;
+
+	for (int depth = firstDepth; depth <= limits.maxDepth; ++depth) {
+		int alpha = -INFINITE_SCORE;
+		int bestIndex = 0;
+		int bestScore = -INFINITE_SCORE;
+
+		for (int i = 0; i < orderedMoves.size(); ++i) {
+			SequenceUndo undo;
+			MakeSequence(board, orderedMoves[i], undo);
+			int score = -Negamax(board, opponent, depth - 1, 1, -INFINITE_SCORE, -alpha);
+			UnmakeSequence(board, orderedMoves[i], undo);
+			if (mStopped) {
+				break;
+			}
+			if (score > bestScore) {
+				bestScore = score;
+				bestIndex = i;
+				if (score > alpha) {
+					alpha = score;
+				}
+			}
+		}
+
+		if (mStopped) {
+			// El primer movimiento es el mejor anterior: si ya se busco y otro lo supero, el otro es mejor
+			if (bestIndex > 0) {
+				result.bestMove = orderedMoves[bestIndex];
+				result.score = bestScore;
+			}
+			break;
+		}
+
+		result.bestMove = orderedMoves[bestIndex];
+		result.score = bestScore;
+		result.depthReached = depth;
+
+		// El mejor movimiento pasa al frente para la siguiente iteracion
+		MoveSequence best = orderedMoves[bestIndex];
+		for (int i = bestIndex; i > 0; --i) {
+			orderedMoves[i] = orderedMoves[i - 1];
+		}
+		orderedMoves[0] = best;
+
+		// Una victoria forzada no mejora buscando mas profundo
+		if (bestScore >= WIN_SCORE - limits.maxDepth || bestScore <= -WIN_SCORE + limits.maxDepth) {
+			break;
+		}
+		if (mHasSoftDeadline && std::chrono::steady_clock::now() >= mSoftDeadline) {
+			break; // La siguiente iteracion probablemente no terminaria a tiempo
+		}
+	}
+
+	result.nodes = mNodes;
+	result.betaCutoffs = mBetaCutoffs;
+	result.firstMoveCutoffs = mFirstMoveCutoffs;
+	result.quiescenceNodes = mQuiescenceNodes;
+	result.tablebaseHits = mTablebaseHits;
+	return result;
+}
+
+// Negamax con poda alfa-beta.
+// Un bando sin movimientos (bloqueado o sin piezas) pierde la partida, igual que en GameManager.
+int SearchEngine::Negamax(Board& board, PlayerColor sideToMove, int depth, int ply, int alpha, int beta) {
+	if (depth <= 0) {
+		return Quiescence(board, sideToMove, ply, alpha, beta);
+	}
+	if (VisitNode()) {
+		return 0;
+	}
+	int tablebaseScore = 0;
+	if (mTablebase && ProbeTablebase(board, sideToMove, ply, tablebaseScore)) {
+		return tablebaseScore;
+	}
+
+	// Consulta la tabla: una entrada con suficiente profundidad puede cerrar el nodo directamente
+	std::uint64_t key = board.GetHashKey();
+	std::uint16_t hashMove = 0;
+	if (mTranspositionTable) {
+		TranspositionEntry entry;
+		if (mTranspositionTable->Probe(key, entry)) {
+			hashMove = entry.move;
+			if (entry.depth >= depth) {
+				int ttScore = ScoreFromTable(entry.score, ply);
+				if (entry.bound == BoundType::EXACT ||
+					(entry.bound == BoundType::LOWER && ttScore >= beta) ||
+					(entry.bound == BoundType::UPPER && ttScore <= alpha)) {
+					return ttScore;
+				}
+			}
+		}
+	}
+
+	MoveSequenceList moves;
+	mMoveGenerator.GenerateMoveSequences(board, sideToMove, moves);
+	if (moves.empty()) {
+		return -WIN_SCORE + ply; // Perder mas tarde es mejor que perder antes
+	}
+
+	// Prioridades de ordenacion: movimiento de la tabla, killers e historial
+	int moveScores[MoveSequenceList::MAX_SIZE];
+	ScoreMoves(moves, ply, hashMove, moveScores);
+
+	PlayerColor opponent = (sideToMove == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+	int originalAlpha = alpha;
+	int bestScore = -INFINITE_SCORE;
+	int bestIndex = 0;
+	for (int i = 0; i < moves.size(); ++i) {
+		PickNextMove(moves, moveScores, i);
+		const MoveSequence& move = moves[i];
+		SequenceUndo undo;
+		MakeSequence(board, move, undo);
+		int score = -Negamax(board, opponent, depth - 1, ply + 1, -beta, -alpha);
+		UnmakeSequence(board, move, undo);
+		if (mStopped) {
+			return 0;
+		}
+		if (score > bestScore) {
+			bestScore = score;
+			bestIndex = i;
+			if (score > alpha) {
+				alpha = score;
+				if (alpha >= beta) {
+					// Corte beta: el oponente no permitira llegar aqui
+					++mBetaCutoffs;
+					if (i == 0) {
+						++mFirstMoveCutoffs;
+					}
+					RecordCutoff(move, ply, depth);
+					break;
+				}
+			}
+		}
+	}
+
+	if (mTranspositionTable) {
+		BoundType bound = (bestScore >= beta) ? BoundType::LOWER
+			: (bestScore <= originalAlpha) ? BoundType::UPPER
+			: BoundType::EXACT;
+		// En un nodo sin ningun movimiento mejor que alfa no hay mejor movimiento fiable
+		std::uint16_t bestMove = (bound == BoundType::UPPER) ? 0 : TranspositionTable::EncodeMove(moves[bestIndex]);
+		mTranspositionTable->Store(key, ScoreToTable(bestScore, ply), depth, bound, bestMove);
+	}
+	return bestScore;
+}
+
+// Los killers solo valen para la busqueda en curso; el historial se conserva reducido a la mitad,
+// porque lo que corto en la jugada anterior suele seguir siendo bueno
+void SearchEngine::ResetMoveOrdering() {
+	for (int ply = 0; ply < MAX_PLY; ++ply) {
+		for (int slot = 0; slot < KILLER_SLOTS; ++slot) {
+			mKillers[ply][slot] = 0;
+		}
+	}
+	for (int from = 0; from < Board::NUM_PLAYABLE_SQUARES; ++from) {
+		for (int to = 0; to < Board::NUM_PLAYABLE_SQUARES; ++to) {
+			mHistory[from][to] /= 2;
+		}
+	}
+}
+
+void SearchEngine::ScoreMoves(const MoveSequenceList& moves, int ply, std::uint16_t hashMove, int* scores) const {
+	const std::uint16_t* killers = (ply < MAX_PLY) ? mKillers[ply] : nullptr;
+	for (int i = 0; i < moves.size(); ++i) {
+		std::uint16_t code = TranspositionTable::EncodeMove(moves[i]);
+		if (hashMove != 0 && code == hashMove) {
+			scores[i] = HASH_MOVE_PRIORITY;
+		}
+		else if (killers && code == killers[0]) {
+			scores[i] = KILLER_PRIORITY + 1;
+		}
+		else if (killers && code == killers[1]) {
+			scores[i] = KILLER_PRIORITY;
+		}
+		else {
+			scores[i] = mHistory[moves[i].startSquare_][moves[i].GetEndSquare()];
+		}
+	}
+}
+
+// Seleccion parcial: solo se ordena hasta donde se llegue antes de un corte
+void SearchEngine::PickNextMove(MoveSequenceList& moves, int* scores, int index) {
+	int best = index;
+	for (int i = index + 1; i < moves.size(); ++i) {
+		if (scores[i] > scores[best]) {
+			best = i;
+		}
+	}
+	if (best != index) {
+		MoveSequence move = moves[best];
+		moves[best] = moves[index];
+		moves[index] = move;
+		int score = scores[best];
+		scores[best] = scores[index];
+		scores[index] = score;
+	}
+}
+
+void SearchEngine::RecordCutoff(const MoveSequence& move, int ply, int depth) {
+	std::uint16_t code = TranspositionTable::EncodeMove(move);
+	if (ply < MAX_PLY && mKillers[ply][0] != code) {
+		mKillers[ply][1] = mKillers[ply][0];
+		mKillers[ply][0] = code;
+	}
+	// Los cortes cerca de la raiz (mas profundidad restante) pesan mas
+	int& history = mHistory[move.startSquare_][move.GetEndSquare()];
+	history += depth * depth;
+	if (history > HISTORY_LIMIT) {
+		for (int from = 0; from < Board::NUM_PLAYABLE_SQUARES; ++from) {
+			for (int to = 0; to < Board::NUM_PLAYABLE_SQUARES; ++to) {
+				mHistory[from][to] /= 2;
+			}
+		}
+	}
+}
+
+// Las hojas sin capturas pendientes se evaluan; con capturas se prueban todas (primero las cadenas
+// mas largas) con poda alfa-beta. Cada captura retira piezas, asi que la extension siempre termina.
+// Estos nodos no se guardan en la tabla de transposicion (solo guarda busquedas con profundidad).
+int SearchEngine::Quiescence(Board& board, PlayerColor sideToMove, int ply, int alpha, int beta) {
+	if (VisitNode()) {
+		return 0;
+	}
+	++mQuiescenceNodes;
+	int tablebaseScore = 0;
+	if (mTablebase && ProbeTablebase(board, sideToMove, ply, tablebaseScore)) {
+		return tablebaseScore;
+	}
+
+	// La mayoria de las hojas no tienen capturas: para evaluarlas basta con saber que el bando puede mover,
+	// y eso se responde con pruebas de movilidad sobre las mascaras, sin generar la lista de movimientos
+	if (!mMoveGenerator.HasAnyCapture(board, sideToMove)) {
+		if (!mMoveGenerator.HasAnyValidMoves(board, sideToMove)) {
+			return -WIN_SCORE + ply;
+		}
+		return mEvaluator.EvaluateBoardState(board, sideToMove);
+	}
+	// Con captura obligatoria el bando siempre puede mover
+	if (!mQuiescenceEnabled || ply >= MAX_PLY - 1) {
+		return mEvaluator.EvaluateBoardState(board, sideToMove);
+	}
+
+	// GenerateMoveSequences aplica la captura obligatoria: todas las secuencias son capturas
+	MoveSequenceList moves;
+	mMoveGenerator.GenerateMoveSequences(board, sideToMove, moves);
+
+	int captureCounts[MoveSequenceList::MAX_SIZE];
+	for (int i = 0; i < moves.size(); ++i) {
+		captureCounts[i] = moves[i].numSteps_;
+	}
+
+	PlayerColor opponent = (sideToMove == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+	int bestScore = -INFINITE_SCORE;
+	for (int i = 0; i < moves.size(); ++i) {
+		PickNextMove(moves, captureCounts, i);
+		SequenceUndo undo;
+		MakeSequence(board, moves[i], undo);
+		int score = -Quiescence(board, opponent, ply + 1, -beta, -alpha);
+		UnmakeSequence(board, moves[i], undo);
+		if (mStopped) {
+			return 0;
+		}
+		if (score > bestScore) {
+			bestScore = score;
+			if (score > alpha) {
+				alpha = score;
+				if (alpha >= beta) {
+					break;
+				}
+			}
+		}
+	}
+	return bestScore;
+}
+
+bool SearchEngine::VisitNode() {
+	++mNodes;
+	if ((mMaxNodes > 0 && mNodes >= mMaxNodes) ||
+		(mNodes % STOP_CHECK_INTERVAL == 0 && IsStopRequested())) {
+		mStopped = true;
+	}
+	return mStopped;
+}
+
+// Una victoria en N turnos desde esta posicion termina la partida N turnos despues: se puntua igual que
+// las victorias que encuentra la busqueda, asi se prefiere la victoria mas corta y la derrota mas larga
+bool SearchEngine::ProbeTablebase(const Board& board, PlayerColor sideToMove, int ply, int& outScore) {
+	TablebaseResult probe;
+	if (!mTablebase->Probe(board, sideToMove, probe)) {
+		return false;
+	}
+	++mTablebaseHits;
+	int endPly = ply + probe.distance;
+	if (endPly > MAX_PLY - 1) {
+		endPly = MAX_PLY - 1; // Sigue siendo una puntuacion de victoria para ScoreToTable
+	}
+	outScore = (probe.outcome == TablebaseOutcome::WIN) ? WIN_SCORE - endPly
+		: (probe.outcome == TablebaseOutcome::LOSS) ? -WIN_SCORE + endPly
+		: 0;
+	return true;
+}
+
+// Cada movimiento de la raiz se puntua con una consulta de la posicion resultante.
+// Si alguna no esta en las tablas (todavia quedan demasiadas piezas) se devuelve false y se busca normalmente.
+bool SearchEngine::SearchTablebaseRoot(Board& board, PlayerColor sideToMove, const MoveSequenceList& rootMoves, SearchResult& outResult) {
+	PlayerColor opponent = (sideToMove == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+	mTablebaseHits = 0;
+	int bestScore = -INFINITE_SCORE;
+	int bestIndex = 0;
+	for (int i = 0; i < rootMoves.size(); ++i) {
+		SequenceUndo undo;
+		MakeSequence(board, rootMoves[i], undo);
+		// Aqui la distancia no se limita a MAX_PLY: la eleccion de la raiz debe distinguir cualquier distancia
+		// para que el ganador siempre acerque el final
+		TablebaseResult probe;
+		bool resolved = true;
+		if (board.GetPieceCount(opponent) == 0) {
+			probe.outcome = TablebaseOutcome::LOSS; // El oponente se queda sin piezas
+		}
+		else {
+			resolved = mTablebase->Probe(board, opponent, probe);
+		}
+		UnmakeSequence(board, rootMoves[i], undo);
+		if (!resolved) {
+			return false;
+		}
+		++mTablebaseHits;
+		int score = (probe.outcome == TablebaseOutcome::LOSS) ? WIN_SCORE - (1 + probe.distance)
+			: (probe.outcome == TablebaseOutcome::WIN) ? -WIN_SCORE + (1 + probe.distance)
+			: 0;
+		if (score > bestScore) {
+			bestScore = score;
+			bestIndex = i;
+		}
+	}
+	outResult = SearchResult();
+	outResult.bestMove = rootMoves[bestIndex];
+	outResult.score = bestScore;
+	outResult.tablebaseHits = mTablebaseHits;
+	return true;
+}
+
+// Convierte una victoria "en N turnos desde la raiz" en "en N turnos desde esta posicion"
+int SearchEngine::ScoreToTable(int score, int ply) {
+	if (score >= WIN_SCORE - TranspositionTable::MAX_PLY) return score + ply;
+	if (score <= -WIN_SCORE + TranspositionTable::MAX_PLY) return score - ply;
+	return score;
+}
+
+// Operacion inversa de ScoreToTable
+int SearchEngine::ScoreFromTable(int score, int ply) {
+	if (score >= WIN_SCORE - TranspositionTable::MAX_PLY) return score - ply;
+	if (score <= -WIN_SCORE + TranspositionTable::MAX_PLY) return score + ply;
+	return score;
+}
+
+// Aplica una secuencia completa paso a paso con Board::MakeMove, el mismo camino que usa el bucle de juego
+void SearchEngine::MakeSequence(Board& board, const MoveSequence& sequence, SequenceUndo& undo) const {
+	for (int step = 0; step < sequence.numSteps_; ++step) {
+		undo.steps[step] = board.MakeMove(sequence.GetCompactStep(step));
+	}
+	// Al terminar la secuencia le toca mover al oponente (la clave Zobrist incluye el turno)
+	board.SetSideToMove((sequence.playerColor_ == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1);
+}
+
+// Deshace una secuencia aplicada con MakeSequence, paso a paso en orden inverso
+void SearchEngine::UnmakeSequence(Board& board, const MoveSequence& sequence, const SequenceUndo& undo) const {
+	board.SetSideToMove(sequence.playerColor_);
+	for (int step = sequence.numSteps_ - 1; step >= 0; --step) {
+		board.UnmakeMove(undo.steps[step]);
+	}
+}
@@ -0,0 +1,149 @@
+#ifndef SEARCH_ENGINE_H
+#define SEARCH_ENGINE_H
+
+#include "CommonTypes.h"   // Para PlayerColor, PieceType
+#include "Board.h"         // Para Board
+#include "MoveGenerator.h" // Para generar las secuencias legales
+#include "MoveSequence.h"  // Para MoveSequence y MoveSequenceList
+#include "Evaluator.h"     // Para la evaluacion de las hojas
+#include "TranspositionTable.h" // Para reutilizar resultados de posiciones repetidas
+#include "EndgameTablebase.h"  // Para el resultado exacto de los finales con pocas piezas
+
+#include <atomic> // Para la senal de parada compartida entre hilos
+#include <chrono> // Para el limite de tiempo
+
+// Limites de una busqueda
+struct SearchLimits {
+	int maxDepth = 4;        // Profundidad maxima (en turnos completos) de la profundizacion iterativa
+	long long maxNodes = 0;  // Presupuesto de nodos por hilo (0 = sin limite)
+	long long maxTimeMs = 0; // Limite duro en milisegundos: la busqueda se corta aunque este a mitad de una iteracion (0 = sin limite)
+	long long softTimeMs = 0; // Limite blando en milisegundos: no se empieza otra iteracion pasado este tiempo (0 = sin limite)
+	int threads = 1;         // Hilos de busqueda (1 = busqueda determinista en el hilo llamador)
+	bool quiescence = true;  // Extiende las hojas con capturas obligatorias pendientes hasta una posicion tranquila
+};
+
+// Resultado de una busqueda
+struct SearchResult {
+	MoveSequence bestMove;    // Mejor movimiento completo encontrado
+	int score = 0;            // Puntuacion del mejor movimiento desde la perspectiva del bando que mueve
+	int depthReached = 0;     // Ultima profundidad completada (0 si la raiz se resolvio con las tablas de finales)
+	long long nodes = 0;      // Nodos visitados en total (sumando todos los hilos)
+	double seconds = 0.0;     // Tiempo empleado en la busqueda
+	long long betaCutoffs = 0;      // Nodos cerrados por un corte beta
+	long long firstMoveCutoffs = 0; // Cortes beta producidos por el primer movimiento probado (mide la ordenacion)
+	long long quiescenceNodes = 0;  // Nodos visitados en la busqueda de quiescencia (incluidos en 'nodes')
+	long long tablebaseHits = 0;    // Posiciones resueltas con las tablas de finales
+};
+
+// Motor de busqueda negamax con poda alfa-beta y profundizacion iterativa.
+// Cada movimiento del arbol es un turno completo (una cadena de capturas entera o un movimiento simple).
+// Los movimientos se hacen y deshacen sobre el mismo tablero, sin copiarlo por nodo.
+// Si se indica una tabla de transposicion, las posiciones a las que se llega por distintos
+// ordenes de movimientos se resuelven con el resultado guardado.
+// En cada nodo los movimientos se prueban en este orden: el mejor movimiento guardado en la tabla,
+// los dos movimientos "killer" de esa distancia a la raiz (los que produjeron cortes en nodos hermanos)
+// y el resto segun la tabla de historial (cortes acumulados por casilla de origen y de destino).
+// Killers e historial se conservan entre las iteraciones de la profundizacion iterativa.
+// Al llegar a la profundidad pedida, si el bando que mueve esta obligado a capturar la posicion no se
+// evalua todavia: se siguen buscando solo las capturas obligatorias (busqueda de quiescencia) hasta una
+// posicion sin capturas. Asi no se corta a mitad de un intercambio (efecto horizonte).
+// Con tablas de finales, las posiciones incluidas en ellas no se buscan: su puntuacion es el resultado
+// exacto. Si todos los movimientos de la raiz llevan a posiciones de las tablas, no se busca nada.
+//
+// Con mas de un hilo la busqueda es "Lazy SMP": hilos auxiliares repiten la misma profundizacion
+// iterativa sobre su propia copia del tablero, con otro orden de movimientos en la raiz, y comparten
+// la tabla de transposicion. Lo que un hilo guarda en la tabla acelera y ordena la busqueda de los demas.
+// El resultado es el del hilo principal, salvo que un auxiliar haya completado una profundidad mayor.
+// Con un solo hilo (o sin tabla) no se crea ningun hilo y el resultado es determinista.
+class SearchEngine {
+public:
+	static constexpr int WIN_SCORE = 100000; // Puntuacion de una victoria (se resta la distancia en turnos)
+	static constexpr int INFINITE_SCORE = 1000000;
+
+	// transpositionTable: tabla compartida (puede ser nullptr); el motor no la posee
+	SearchEngine(const MoveGenerator& moveGenerator, TranspositionTable* transpositionTable = nullptr);
+
+	// Busca el mejor movimiento entre 'rootMoves' para el bando 'sideToMove'.
+	// El tablero se modifica durante la busqueda y se deja igual que al principio.
+	SearchResult Search(Board& board, PlayerColor sideToMove, const MoveSequenceList& rootMoves, const SearchLimits& limits);
+
+	// Tablas de finales a consultar (nullptr para no usarlas); el motor no las posee
+	void SetTablebase(const EndgameTablebase* tablebase) { mTablebase = tablebase; }
+
+	static constexpr long long STOP_CHECK_INTERVAL = 1024; // Nodos entre comprobaciones del tiempo y de la senal de parada
+	static constexpr int MAX_PLY = TranspositionTable::MAX_PLY; // Distancia maxima a la raiz con killers propios
+	static constexpr int KILLER_SLOTS = 2;                      // Movimientos killer por distancia a la raiz
+
+private:
+	const MoveGenerator& mMoveGenerator; // Generador de movimientos legales
+	Evaluator mEvaluator;                // Evaluacion estatica de las hojas
+	TranspositionTable* mTranspositionTable; // Tabla de transposicion (nullptr si no se usa)
+	const EndgameTablebase* mTablebase;  // Tablas de finales (nullptr si no se usan)
+	long long mNodes;                    // Nodos visitados en la busqueda actual
+	long long mMaxNodes;                 // Presupuesto de nodos de la busqueda actual (0 = sin limite)
+	bool mStopped;                       // Indica que la busqueda se corto (presupuesto, tiempo o senal de parada)
+	std::atomic<bool>* mStopSignal;      // Senal de parada compartida con los hilos auxiliares (nullptr con un solo hilo)
+	bool mHasDeadline;                   // Indica si la busqueda actual tiene limite duro de tiempo
+	std::chrono::steady_clock::time_point mDeadline; // Momento en que la busqueda debe cortarse
+	bool mHasSoftDeadline;               // Indica si la busqueda actual tiene limite blando de tiempo
+	std::chrono::steady_clock::time_point mSoftDeadline; // Momento a partir del cual no se empiezan iteraciones
+
+	// --- Ordenacion de movimientos ---
+	std::uint16_t mKillers[MAX_PLY][KILLER_SLOTS]; // Movimientos que produjeron un corte a cada distancia (codigo de EncodeMove)
+	int mHistory[Board::NUM_PLAYABLE_SQUARES][Board::NUM_PLAYABLE_SQUARES]; // Historial de cortes por [origen][destino]
+	long long mBetaCutoffs;      // Cortes beta de la busqueda actual
+	long long mFirstMoveCutoffs; // Cortes beta producidos por el primer movimiento probado
+	long long mQuiescenceNodes;  // Nodos de la busqueda de quiescencia
+	bool mQuiescenceEnabled;     // Indica si las hojas se extienden con capturas obligatorias
+	long long mTablebaseHits;    // Posiciones resueltas con las tablas de finales
+
+	// Prioridades de ordenacion (por encima de cualquier valor del historial)
+	static constexpr int HASH_MOVE_PRIORITY = 1 << 30;
+	static constexpr int KILLER_PRIORITY = 1 << 29;
+	static constexpr int HISTORY_LIMIT = 1 << 20; // Al superarlo se reduce todo el historial a la mitad
+
+	// Limpia los killers y envejece el historial al empezar una busqueda
+	void ResetMoveOrdering();
+	// Asigna una prioridad de ordenacion a cada movimiento del nodo
+	void ScoreMoves(const MoveSequenceList& moves, int ply, std::uint16_t hashMove, int* scores) const;
+	// Lleva al indice 'index' el movimiento de mayor prioridad entre los que faltan por probar
+	static void PickNextMove(MoveSequenceList& moves, int* scores, int index);
+	// Registra un movimiento que produjo un corte beta: killer de su distancia y refuerzo en el historial
+	void RecordCutoff(const MoveSequence& move, int ply, int depth);
+
+	// Reinicia los contadores y limites de una busqueda que empezo en 'start'
+	void PrepareSearch(const SearchLimits& limits, std::chrono::steady_clock::time_point start, std::atomic<bool>* stopSignal);
+	// Profundizacion iterativa desde 'firstDepth' hasta 'limits.maxDepth' sobre 'rootMoves'
+	SearchResult IterativeDeepening(Board& board, PlayerColor sideToMove, const MoveSequenceList& rootMoves, const SearchLimits& limits, int firstDepth);
+	// Indica si se agoto el tiempo o si otro hilo pidio parar
+	bool IsStopRequested() const;
+
+	// Busqueda negamax con poda alfa-beta. Devuelve la puntuacion desde la perspectiva de 'sideToMove'.
+	int Negamax(Board& board, PlayerColor sideToMove, int depth, int ply, int alpha, int beta);
+	// Busqueda de quiescencia: en una hoja con captura obligatoria sigue buscando solo las capturas.
+	// Como capturar es obligatorio, no hay opcion de quedarse con la evaluacion estatica ("stand pat").
+	int Quiescence(Board& board, PlayerColor sideToMove, int ply, int alpha, int beta);
+	// Cuenta un nodo y comprueba los limites. Devuelve true si la busqueda debe cortarse.
+	bool VisitNode();
+
+	// Consulta las tablas de finales. Devuelve true y la puntuacion exacta si la posicion esta en ellas.
+	bool ProbeTablebase(const Board& board, PlayerColor sideToMove, int ply, int& outScore);
+	// Elige el movimiento de la raiz solo con las tablas, si todas las posiciones a las que lleva estan en ellas
+	bool SearchTablebaseRoot(Board& board, PlayerColor sideToMove, const MoveSequenceList& rootMoves, SearchResult& outResult);
+
+	// Las victorias se guardan en la tabla como distancia desde la posicion y no desde la raiz,
+	// para que el valor sea valido sin importar por que camino se llego a ella
+	static int ScoreToTable(int score, int ply);
+	static int ScoreFromTable(int score, int ply);
+
+	// Registro para deshacer un movimiento completo: un MoveUndo por paso de la secuencia
+	struct SequenceUndo {
+		MoveUndo steps[MoveSequence::MAX_STEPS];
+	};
+	// Aplica una secuencia completa sobre el tablero y guarda lo necesario para deshacerla
+	void MakeSequence(Board& board, const MoveSequence& sequence, SequenceUndo& undo) const;
+	// Deshace una secuencia aplicada con MakeSequence
+	void UnmakeSequence(Board& board, const MoveSequence& sequence, const SequenceUndo& undo) const;
+};
+
+#endif // SEARCH_ENGINE_H
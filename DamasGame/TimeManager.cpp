@@ -0,0 +1,42 @@
+#include "TimeManager.h"
+
+#include <algorithm> // Para std::min y std::max
+
+// Constructor de TimeManager: sin control de tiempo
+TimeManager::TimeManager()
+	: mTimeControl(),
+	mRemainingMs(0) {
+}
+
+void TimeManager::SetTimeControl(const TimeControl& timeControl) {
+	mTimeControl = timeControl;
+	mRemainingMs = timeControl.gameTimeMs;
+}
+
+// Con tiempo por jugada, el limite duro es ese tiempo y el blando la mitad: una iteracion
+// nueva suele costar mas que todas las anteriores juntas, asi que empezarla despues de la mitad
+// casi nunca se termina.
+// Con reloj por partida, el limite blando es una parte del reloj mas la mayor parte del incremento,
+// y el limite duro unas veces el blando, sin pasar de la mitad de lo que queda.
+void TimeManager::AllocateMoveTime(SearchLimits& limits) const {
+	if (mTimeControl.moveTimeMs > 0) {
+		limits.maxTimeMs = std::max(mTimeControl.moveTimeMs - SAFETY_MARGIN_MS, 1LL);
+		limits.softTimeMs = std::max(limits.maxTimeMs / 2, 1LL);
+		return;
+	}
+	if (mTimeControl.gameTimeMs > 0) {
+		long long available = std::max(mRemainingMs - SAFETY_MARGIN_MS, 1LL);
+		int movesToGo = (mTimeControl.movesToGo > 0) ? mTimeControl.movesToGo : DEFAULT_MOVES_TO_GO;
+		long long soft = available / movesToGo + mTimeControl.incrementMs * 3 / 4;
+		long long hard = std::min(soft * HARD_LIMIT_FACTOR, available / 2 + mTimeControl.incrementMs);
+		hard = std::max(std::min(hard, available), 1LL);
+		limits.maxTimeMs = hard;
+		limits.softTimeMs = std::max(std::min(soft, hard), 1LL);
+	}
+}
+
+void TimeManager::MoveFinished(long long elapsedMs) {
+	if (mTimeControl.gameTimeMs > 0) {
+		mRemainingMs = std::max(mRemainingMs - elapsedMs, 0LL) + mTimeControl.incrementMs;
+	}
+}
@@ -0,0 +1,48 @@
+#ifndef TIME_MANAGER_H
+#define TIME_MANAGER_H
+
+#include "SearchEngine.h" // Para SearchLimits
+
+// Control de tiempo de la IA. Se puede dar un tiempo fijo por jugada o un tiempo total por partida
+// con incremento por jugada (si se dan ambos, manda el tiempo por jugada).
+struct TimeControl {
+	long long moveTimeMs = 0;  // Tiempo fijo por jugada en milisegundos (0 = no se usa)
+	long long gameTimeMs = 0;  // Tiempo total de la partida en milisegundos (0 = no se usa)
+	long long incrementMs = 0; // Tiempo que se suma al reloj tras cada jugada
+	int movesToGo = 0;         // Jugadas que quedan hasta el siguiente control (0 = estimacion por defecto)
+
+	bool IsActive() const { return moveTimeMs > 0 || gameTimeMs > 0; }
+};
+
+// Reparte el reloj entre las jugadas y lo traduce a los limites de la busqueda:
+// - limite blando: pasado este tiempo no se empieza otra iteracion de la profundizacion iterativa;
+// - limite duro: la busqueda se corta aunque este a mitad de una iteracion.
+// El limite duro nunca supera el tiempo que queda en el reloj, de modo que la latencia de la IA
+// queda acotada.
+class TimeManager {
+public:
+	static constexpr long long SAFETY_MARGIN_MS = 20;    // Reserva para generar movimientos y devolver la jugada
+	static constexpr int DEFAULT_MOVES_TO_GO = 30;      // Jugadas restantes estimadas en partidas con reloj
+	static constexpr int HARD_LIMIT_FACTOR = 3;         // Veces el limite blando que puede durar una jugada dificil
+
+	TimeManager();
+
+	// Fija el control de tiempo y pone el reloj a cero (inicio de partida)
+	void SetTimeControl(const TimeControl& timeControl);
+	const TimeControl& GetTimeControl() const { return mTimeControl; }
+	bool IsActive() const { return mTimeControl.IsActive(); }
+
+	// Calcula los limites blando y duro de la jugada actual
+	void AllocateMoveTime(SearchLimits& limits) const;
+	// Descuenta el tiempo usado en una jugada y suma el incremento
+	void MoveFinished(long long elapsedMs);
+
+	// Tiempo que queda en el reloj de la partida
+	long long GetRemainingMs() const { return mRemainingMs; }
+
+private:
+	TimeControl mTimeControl; // Control de tiempo configurado
+	long long mRemainingMs;   // Tiempo que queda en el reloj (si hay tiempo por partida)
+};
+
+#endif // TIME_MANAGER_H
@@ -0,0 +1,111 @@
+#include "TranspositionTable.h"
+
+namespace {
+	// Posiciones de cada campo dentro de la palabra de datos
+	constexpr int MOVE_SHIFT = 0;
+	constexpr int SCORE_SHIFT = 16;
+	constexpr int DEPTH_SHIFT = 48;
+	constexpr int BOUND_SHIFT = 56;
+	constexpr int GENERATION_SHIFT = 58;
+	constexpr std::uint8_t GENERATION_MASK = 0x3F;
+
+	int UnpackScore(std::uint64_t data) {
+		return static_cast<int>(static_cast<std::int32_t>(static_cast<std::uint32_t>(data >> SCORE_SHIFT)));
+	}
+	int UnpackDepth(std::uint64_t data) {
+		return static_cast<int>(static_cast<std::int8_t>(static_cast<std::uint8_t>(data >> DEPTH_SHIFT)));
+	}
+	BoundType UnpackBound(std::uint64_t data) {
+		return static_cast<BoundType>((data >> BOUND_SHIFT) & 0x3);
+	}
+	std::uint8_t UnpackGeneration(std::uint64_t data) {
+		return static_cast<std::uint8_t>((data >> GENERATION_SHIFT) & GENERATION_MASK);
+	}
+}
+
+// Constructor: reserva la mayor potencia de dos de entradas que cabe en 'sizeMb' MB
+TranspositionTable::TranspositionTable(int sizeMb)
+	: mEntryCount(1),
+	mIndexMask(0),
+	mGeneration(0) {
+	if (sizeMb < 1) sizeMb = 1;
+	std::size_t maxEntries = (static_cast<std::size_t>(sizeMb) * 1024 * 1024) / sizeof(Slot);
+	while (mEntryCount * 2 <= maxEntries) {
+		mEntryCount *= 2;
+	}
+	mIndexMask = mEntryCount - 1;
+	mSlots.reset(new Slot[mEntryCount]);
+	Clear();
+}
+
+// Vacia todas las entradas (una entrada con ambas palabras a cero tiene cota NONE)
+void TranspositionTable::Clear() {
+	for (std::size_t i = 0; i < mEntryCount; ++i) {
+		mSlots[i].keyXorData.store(0, std::memory_order_relaxed);
+		mSlots[i].data.store(0, std::memory_order_relaxed);
+	}
+	mGeneration = 0;
+}
+
+// Avanza la generacion para que las entradas viejas se reemplacen aunque tengan mas profundidad
+void TranspositionTable::NewSearch() {
+	mGeneration = static_cast<std::uint8_t>((mGeneration + 1) & GENERATION_MASK);
+}
+
+// Empaqueta los campos de una entrada en una palabra de 64 bits
+std::uint64_t TranspositionTable::PackData(int score, int depth, BoundType bound, std::uint16_t move, std::uint8_t generation) {
+	return (static_cast<std::uint64_t>(move) << MOVE_SHIFT) |
+		(static_cast<std::uint64_t>(static_cast<std::uint32_t>(score)) << SCORE_SHIFT) |
+		(static_cast<std::uint64_t>(static_cast<std::uint8_t>(depth)) << DEPTH_SHIFT) |
+		(static_cast<std::uint64_t>(bound) << BOUND_SHIFT) |
+		(static_cast<std::uint64_t>(generation & GENERATION_MASK) << GENERATION_SHIFT);
+}
+
+// Lee una entrada. Las dos palabras se leen por separado; si otro hilo escribio entre
+// ambas lecturas, la clave reconstruida no coincide y la entrada se ignora.
+bool TranspositionTable::Probe(std::uint64_t key, TranspositionEntry& entry) const {
+	const Slot& slot = mSlots[key & mIndexMask];
+	std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+	std::uint64_t keyXorData = slot.keyXorData.load(std::memory_order_relaxed);
+	if ((keyXorData ^ data) != key || UnpackBound(data) == BoundType::NONE) {
+		return false;
+	}
+
+	entry.score = UnpackScore(data);
+	entry.depth = UnpackDepth(data);
+	entry.bound = UnpackBound(data);
+	entry.move = static_cast<std::uint16_t>(data >> MOVE_SHIFT);
+	return true;
+}
+
+// Guarda una entrada. Se reemplaza la existente si es de la misma posicion, de una busqueda anterior
+// o si la nueva se busco con al menos la misma profundidad.
+void TranspositionTable::Store(std::uint64_t key, int score, int depth, BoundType bound, std::uint16_t move) {
+	Slot& slot = mSlots[key & mIndexMask];
+	std::uint64_t oldData = slot.data.load(std::memory_order_relaxed);
+	std::uint64_t oldKey = slot.keyXorData.load(std::memory_order_relaxed) ^ oldData;
+	bool samePosition = (oldKey == key);
+	if (!samePosition && UnpackBound(oldData) != BoundType::NONE &&
+		UnpackGeneration(oldData) == mGeneration && UnpackDepth(oldData) > depth) {
+		return; // La entrada actual es mas valiosa
+	}
+	// Conserva el mejor movimiento conocido si la nueva busqueda no encontro ninguno
+	if (move == 0 && samePosition) {
+		move = static_cast<std::uint16_t>(oldData >> MOVE_SHIFT);
+	}
+
+	std::uint64_t data = PackData(score, depth, bound, move, mGeneration);
+	slot.keyXorData.store(key ^ data, std::memory_order_relaxed);
+	slot.data.store(data, std::memory_order_relaxed);
+}
+
+// 5 bits por casilla: inicio, primer aterrizaje y final. El bit 15 marca el codigo como valido.
+std::uint16_t TranspositionTable::EncodeMove(const MoveSequence& sequence) {
+	if (sequence.IsNull()) {
+		return 0;
+	}
+	return static_cast<std::uint16_t>(0x8000 |
+		(sequence.startSquare_ & 0x1F) |
+		((sequence.landingSquares_[0] & 0x1F) << 5) |
+		((sequence.GetEndSquare() & 0x1F) << 10));
+}
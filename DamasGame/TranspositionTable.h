@@ -0,0 +1,75 @@
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+
+#include "MoveSequence.h" // Para MoveSequence
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Tipo de cota guardada en una entrada de la tabla
+enum class BoundType : std::uint8_t {
+	NONE = 0,  // Entrada vacia
+	EXACT = 1, // La puntuacion es exacta
+	LOWER = 2, // La puntuacion es una cota inferior (hubo corte beta)
+	UPPER = 3  // La puntuacion es una cota superior (ningun movimiento supero alfa)
+};
+
+// Datos de una posicion leidos de la tabla
+struct TranspositionEntry {
+	int score = 0;                        // Puntuacion guardada (las victorias, relativas a la posicion)
+	int depth = 0;                        // Profundidad restante con la que se busco la posicion
+	BoundType bound = BoundType::NONE;    // Tipo de cota de 'score'
+	std::uint16_t move = 0;               // Codigo del mejor movimiento (0 = ninguno), ver EncodeMove
+};
+
+// Tabla de transposicion de tamano fijo (potencia de dos) indexada por la clave Zobrist.
+// Cada entrada ocupa 16 bytes: la clave XOR los datos y los datos empaquetados en 64 bits.
+// Varios hilos pueden leer y escribir sin bloqueos: si una escritura concurrente mezcla
+// las dos palabras, la verificacion XOR no coincide y la entrada se descarta.
+class TranspositionTable {
+public:
+	static constexpr int DEFAULT_SIZE_MB = 16; // Tamano por defecto de la tabla en MB
+	static constexpr int MAX_PLY = 128;        // Profundidad maxima desde la raiz (para ajustar puntuaciones de victoria)
+
+	// Crea una tabla de 'sizeMb' MB (se redondea hacia abajo a una potencia de dos de entradas)
+	explicit TranspositionTable(int sizeMb = DEFAULT_SIZE_MB);
+
+	TranspositionTable(const TranspositionTable&) = delete;
+	TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+	// Vacia todas las entradas
+	void Clear();
+	// Marca el comienzo de una busqueda nueva: las entradas de busquedas anteriores pasan a ser reemplazables
+	void NewSearch();
+
+	// Busca la posicion 'key'. Devuelve true y rellena 'entry' si la entrada es valida.
+	bool Probe(std::uint64_t key, TranspositionEntry& entry) const;
+	// Guarda el resultado de buscar la posicion 'key' (reemplazo preferente por profundidad)
+	void Store(std::uint64_t key, int score, int depth, BoundType bound, std::uint16_t move);
+
+	// Codifica un movimiento completo en 16 bits: casilla de inicio, primer aterrizaje y casilla final.
+	// Basta para reconocer el movimiento entre las secuencias legales de la posicion al ordenar.
+	static std::uint16_t EncodeMove(const MoveSequence& sequence);
+
+	// Cantidad de entradas de la tabla
+	std::size_t GetEntryCount() const { return mEntryCount; }
+
+private:
+	// Entrada de 16 bytes. Cada palabra se lee y escribe de forma atomica (relajada).
+	struct Slot {
+		std::atomic<std::uint64_t> keyXorData; // Clave Zobrist XOR datos
+		std::atomic<std::uint64_t> data;       // Datos empaquetados (ver PackData)
+	};
+
+	std::unique_ptr<Slot[]> mSlots; // Entradas de la tabla
+	std::size_t mEntryCount;        // Cantidad de entradas (potencia de dos)
+	std::size_t mIndexMask;         // mEntryCount - 1
+	std::uint8_t mGeneration;       // Generacion de la busqueda actual (6 bits)
+
+	// Empaqueta: movimiento (16) | puntuacion (32) | profundidad (8) | cota (2) | generacion (6)
+	static std::uint64_t PackData(int score, int depth, BoundType bound, std::uint16_t move, std::uint8_t generation);
+};
+
+#endif // TRANSPOSITION_TABLE_H
@@ -0,0 +1,293 @@
+// Herramienta perft para el generador de movimientos.
+// Cuenta los caminos de movimientos (hojas) hasta una profundidad dada, en turnos completos:
+// una cadena de capturas entera cuenta como un solo movimiento, igual que en la busqueda de la IA.
+// Aplica las mismas reglas que el juego: captura obligatoria, prioridad de captura de Dama
+// y continuacion obligatoria de las cadenas de saltos.
+//
+// Uso:
+//   Perft [profundidad] [posicion]          Cuenta nodos a profundidad 1..N (por defecto 7 desde la posicion inicial)
+//   Perft --divide <profundidad> [posicion] Muestra el conteo por cada movimiento de la raiz
+//   Perft --suite                           Comprueba la tabla de conteos conocidos (codigo de salida 1 si falla)
+//   Perft --alloc                           Comprueba que generar y validar movimientos no reserva memoria dinamica
+// La posicion usa el formato de Board::LoadPositionString.
+
+#include "Board.h"         // Para Board y MoveUndo
+#include "CommonTypes.h"   // Para PlayerColor, ToAlgebraic
+#include "MoveGenerator.h" // Para generar las secuencias legales
+#include "MoveSequence.h"  // Para MoveSequence y MoveSequenceList
+
+#include <atomic>   // Para el contador de reservas
+#include <chrono>   // Para medir nodos por segundo
+#include <cstdlib>  // Para std::atoi, std::malloc y std::free
+#include <iostream>
+#include <new>      // Para std::bad_alloc
+#include <string>
+
+// Contador de reservas de memoria dinamica del programa. Se reemplazan los operadores globales para
+// que --alloc pueda comprobar que la interfaz de MoveGenerator no reserva memoria.
+namespace {
+	std::atomic<unsigned long long> gAllocationCount(0);
+}
+
+void* operator new(std::size_t size) {
+	++gAllocationCount;
+	void* memory = std::malloc(size == 0 ? 1 : size);
+	if (memory == nullptr) {
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+namespace {
+	const char* const START_POSITION = "W:bbbbbbbbbbbb........wwwwwwwwwwww";
+
+	// Conteo conocido de una posicion a una profundidad.
+	// Los valores se verificaron con una enumeracion salto a salto independiente (el generador original).
+	struct PerftCase {
+		const char* position;
+		int depth;
+		unsigned long long nodes;
+	};
+
+	const PerftCase PERFT_SUITE[] = {
+		{ START_POSITION, 1, 7 },
+		{ START_POSITION, 2, 49 },
+		{ START_POSITION, 3, 302 },
+		{ START_POSITION, 4, 1469 },
+		{ START_POSITION, 5, 7361 },
+		{ START_POSITION, 6, 36768 },
+		{ START_POSITION, 7, 179740 },
+		{ START_POSITION, 8, 845931 },
+		{ START_POSITION, 9, 3963629 }, // Difiere de las damas inglesas por la prioridad de captura de Dama
+		// Medio juego con Damas de ambos bandos y cadenas de varios saltos
+		{ "B:bbW.b..b...b.....w.b.....wwwwB..", 6, 5858 },
+		{ "B:bbW.b..b...b.....w.b.....wwwwB..", 8, 142362 },
+		{ "W:...b..W.Bbb.....bb.w........w...", 6, 23170 },
+		{ "W:...b..W.Bbb.....bb.w........w...", 8, 525770 },
+		{ "W:..Wb..b..bbw.....b.B.w..w...w...", 8, 58608 },
+	};
+
+	PlayerColor Opponent(PlayerColor player) {
+		return (player == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+	}
+
+	// Aplica una secuencia completa salto a salto con Board::MakeMove y pasa el turno
+	void MakeSequence(Board& board, const MoveSequence& sequence, MoveUndo (&undo)[MoveSequence::MAX_STEPS]) {
+		for (int step = 0; step < sequence.numSteps_; ++step) {
+			undo[step] = board.MakeMove(sequence.GetCompactStep(step));
+		}
+		board.SetSideToMove(Opponent(sequence.playerColor_));
+	}
+
+	// Deshace una secuencia aplicada con MakeSequence
+	void UnmakeSequence(Board& board, const MoveSequence& sequence, const MoveUndo (&undo)[MoveSequence::MAX_STEPS]) {
+		board.SetSideToMove(sequence.playerColor_);
+		for (int step = sequence.numSteps_ - 1; step >= 0; --step) {
+			board.UnmakeMove(undo[step]);
+		}
+	}
+
+	// Cuenta las hojas a 'depth' turnos. En el ultimo nivel basta con el tamano de la lista.
+	unsigned long long Perft(Board& board, const MoveGenerator& generator, int depth) {
+		MoveSequenceList moves;
+		generator.GenerateMoveSequences(board, board.GetSideToMove(), moves);
+		if (depth <= 1) {
+			return static_cast<unsigned long long>(moves.size());
+		}
+		unsigned long long nodes = 0;
+		for (const MoveSequence& move : moves) {
+			MoveUndo undo[MoveSequence::MAX_STEPS];
+			MakeSequence(board, move, undo);
+			nodes += Perft(board, generator, depth - 1);
+			UnmakeSequence(board, move, undo);
+		}
+		return nodes;
+	}
+
+	// Texto de una secuencia: casilla de inicio y cada aterrizaje (por ejemplo "C3-E5-G7")
+	std::string SequenceToString(const MoveSequence& sequence) {
+		std::string text = ToAlgebraic(Board::SquareToRow(sequence.startSquare_), Board::SquareToCol(sequence.startSquare_));
+		for (int step = 0; step < sequence.numSteps_; ++step) {
+			int square = sequence.landingSquares_[step];
+			text += (sequence.isCapture_ ? "x" : "-");
+			text += ToAlgebraic(Board::SquareToRow(square), Board::SquareToCol(square));
+		}
+		return text;
+	}
+
+	double SecondsSince(std::chrono::steady_clock::time_point start) {
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	bool LoadPosition(Board& board, const char* position) {
+		if (!board.LoadPositionString(position)) {
+			std::cerr << "Posicion no valida: " << position << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	// Conteo a cada profundidad 1..maxDepth con tiempo y nodos por segundo
+	int RunPerft(const char* position, int maxDepth) {
+		Board board;
+		MoveGenerator generator;
+		if (!LoadPosition(board, position)) return 1;
+		std::cout << "Posicion: " << board.ToPositionString() << std::endl;
+		for (int depth = 1; depth <= maxDepth; ++depth) {
+			auto start = std::chrono::steady_clock::now();
+			unsigned long long nodes = Perft(board, generator, depth);
+			double seconds = SecondsSince(start);
+			std::cout << "perft(" << depth << ") = " << nodes << "  " << seconds << " s";
+			if (seconds > 0) {
+				std::cout << "  " << static_cast<unsigned long long>(nodes / seconds) << " nodos/s";
+			}
+			std::cout << std::endl;
+		}
+		return 0;
+	}
+
+	// Conteo separado por cada movimiento de la raiz (para localizar diferencias)
+	int RunDivide(const char* position, int depth) {
+		Board board;
+		MoveGenerator generator;
+		if (!LoadPosition(board, position)) return 1;
+		MoveSequenceList moves;
+		generator.GenerateMoveSequences(board, board.GetSideToMove(), moves);
+		unsigned long long total = 0;
+		for (const MoveSequence& move : moves) {
+			MoveUndo undo[MoveSequence::MAX_STEPS];
+			MakeSequence(board, move, undo);
+			unsigned long long nodes = (depth <= 1) ? 1 : Perft(board, generator, depth - 1);
+			UnmakeSequence(board, move, undo);
+			std::cout << SequenceToString(move) << ": " << nodes << std::endl;
+			total += nodes;
+		}
+		std::cout << "Movimientos: " << moves.size() << "  Nodos: " << total << std::endl;
+		return 0;
+	}
+
+	// Llama a toda la interfaz de MoveGenerator en la posicion actual y recorre sus movimientos hasta
+	// 'depth' turnos. Devuelve las posiciones visitadas.
+	unsigned long long ExerciseGenerator(Board& board, const MoveGenerator& generator, int depth) {
+		PlayerColor player = board.GetSideToMove();
+		MoveList moves;
+		generator.GetMandatoryActionType(board, player, moves);
+		generator.GenerateLegalMoves(board, player, moves);
+		generator.HasAnyValidMoves(board, player);
+		for (int square = 0; square < Board::NUM_PLAYABLE_SQUARES; ++square) {
+			int row = Board::SquareToRow(square);
+			int col = Board::SquareToCol(square);
+			generator.GetPossibleJumpsForSpecificPiece(board, row, col);
+			for (const Move& move : generator.GenerateMovesForPiece(board, row, col)) {
+				bool wasCapture = false;
+				generator.IsValidMove(board, move.startR_, move.startC_, move.endR_, move.endC_, player, wasCapture);
+			}
+			MoveSequenceList captures;
+			if (generator.GetPlayerFromPiece(board.GetPieceAtSquare(square)) == player) {
+				generator.GenerateCaptureSequencesForPiece(board, row, col, captures);
+			}
+		}
+
+		MoveSequenceList sequences;
+		generator.GenerateMoveSequences(board, player, sequences);
+		unsigned long long positions = 1;
+		if (depth > 1) {
+			for (const MoveSequence& move : sequences) {
+				MoveUndo undo[MoveSequence::MAX_STEPS];
+				MakeSequence(board, move, undo);
+				positions += ExerciseGenerator(board, generator, depth - 1);
+				UnmakeSequence(board, move, undo);
+			}
+		}
+		return positions;
+	}
+
+	// Recorre las posiciones de la tabla de conteos con ExerciseGenerator y cuenta las reservas de memoria
+	// dinamica. Devuelve 1 si hubo alguna.
+	int RunAllocationCheck() {
+		const int depth = 4;
+		MoveGenerator generator;
+		unsigned long long positions = 0;
+		unsigned long long allocations = 0;
+		const char* previousPosition = nullptr;
+		for (const PerftCase& perftCase : PERFT_SUITE) {
+			if (previousPosition != nullptr && std::string(previousPosition) == perftCase.position) {
+				continue; // La tabla repite posiciones con otras profundidades
+			}
+			previousPosition = perftCase.position;
+			Board board;
+			if (!LoadPosition(board, perftCase.position)) {
+				return 1;
+			}
+			unsigned long long before = gAllocationCount.load();
+			positions += ExerciseGenerator(board, generator, depth);
+			allocations += gAllocationCount.load() - before;
+		}
+		std::cout << "Posiciones: " << positions << "  Reservas de memoria: " << allocations << std::endl;
+		std::cout << (allocations == 0 ? "La generacion de movimientos no reserva memoria." : "La generacion de movimientos reserva memoria.") << std::endl;
+		return (allocations == 0) ? 0 : 1;
+	}
+
+	// Recorre la tabla de conteos conocidos. Devuelve 1 si algun conteo no coincide.
+	int RunSuite() {
+		MoveGenerator generator;
+		int failures = 0;
+		unsigned long long totalNodes = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (const PerftCase& perftCase : PERFT_SUITE) {
+			Board board;
+			if (!LoadPosition(board, perftCase.position)) {
+				++failures;
+				continue;
+			}
+			unsigned long long nodes = Perft(board, generator, perftCase.depth);
+			totalNodes += nodes;
+			bool ok = (nodes == perftCase.nodes);
+			if (!ok) ++failures;
+			std::cout << (ok ? "[OK]    " : "[FALLO] ") << perftCase.position << " profundidad " << perftCase.depth
+				<< ": " << nodes;
+			if (!ok) std::cout << " (esperado " << perftCase.nodes << ")";
+			std::cout << std::endl;
+		}
+		double seconds = SecondsSince(start);
+		std::cout << "Nodos: " << totalNodes << "  " << seconds << " s";
+		if (seconds > 0) {
+			std::cout << "  " << static_cast<unsigned long long>(totalNodes / seconds) << " nodos/s";
+		}
+		std::cout << std::endl;
+		std::cout << (failures == 0 ? "Todos los conteos coinciden." : "Hay conteos que no coinciden.") << std::endl;
+		return (failures == 0) ? 0 : 1;
+	}
+}
+
+// Funcion principal
+int main(int argc, char* argv[]) {
+	std::string firstArg = (argc > 1) ? argv[1] : "";
+	if (firstArg == "--suite") {
+		return RunSuite();
+	}
+	if (firstArg == "--alloc") {
+		return RunAllocationCheck();
+	}
+	if (firstArg == "--divide") {
+		if (argc < 3) {
+			std::cerr << "Uso: Perft --divide <profundidad> [posicion]" << std::endl;
+			return 1;
+		}
+		return RunDivide((argc > 3) ? argv[3] : START_POSITION, std::atoi(argv[2]));
+	}
+	int depth = (argc > 1) ? std::atoi(argv[1]) : 7;
+	if (depth < 1) {
+		std::cerr << "Uso: Perft [profundidad] [posicion] | --divide <profundidad> [posicion] | --suite | --alloc" << std::endl;
+		return 1;
+	}
+	return RunPerft((argc > 2) ? argv[2] : START_POSITION, depth);
+}
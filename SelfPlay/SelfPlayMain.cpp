@@ -0,0 +1,553 @@
+// Auto-juego por lotes: partidas computadora contra computadora sin interfaz, en todos los nucleos.
+// Cada partida se juega sobre un GameEngine (sin consola ni pausas) y su resultado se guarda con el
+// mismo formato que damas_results.txt. Al terminar se informa el ritmo y el reparto de resultados.
+//
+// Uso:
+//   SelfPlay [--games N] [--threads T] [--white D] [--black D] [--white-engine E] [--black-engine E]
+//            [--max-turns M] [--hash MB] [--search-threads S]
+//            [--move-time MS | --game-time MS [--increment MS]] [--tablebase archivo] [--book archivo]
+//            [--record archivo] [--output archivo]
+//   SelfPlay --bench-search [--search-threads S] [--time MS] [--hash MB]
+//   SelfPlay --bench-mcts [--search-threads S] [--time MS]
+//   SelfPlay --bench-eval
+//     --games      Cantidad de partidas (por defecto 100)
+//     --threads    Hilos de trabajo (por defecto, los nucleos disponibles)
+//     --white      Dificultad de las Blancas, 1..5 (por defecto 1)
+//     --black      Dificultad de las Negras, 1..5 (por defecto 1)
+//     --white-engine, --black-engine  Motor de IA de cada bando: "alfabeta" (ComputerPlayer, por defecto)
+//                  o "mcts" (MctsComputerPlayer). Con --move-time o --game-time ambos piensan el mismo tiempo.
+//     --max-turns  Turnos tras los que la partida se da por empatada (por defecto 200)
+//     --hash       MB de tabla de transposicion por jugador (por defecto 4)
+//     --search-threads  Hilos de busqueda de cada jugador (por defecto 1); en MCTS, arboles en paralelo
+//     --move-time  Tiempo fijo por jugada en milisegundos (la profundidad la decide el reloj)
+//     --game-time  Reloj de cada jugador para toda la partida, en milisegundos
+//     --increment  Milisegundos que se suman al reloj tras cada jugada
+//     --tablebase  Tablas de finales que consultan ambos jugadores (generadas con la herramienta Tablebase)
+//     --book       Libro de aperturas que consultan ambos jugadores (generado con la herramienta BookBuilder)
+//     --record     Agrega las jugadas de cada partida a este archivo, una partida por linea: el resultado
+//                  ("1-0", "0-1" o "1/2") y cada turno como "C3-D4" o, si captura, "C3xE5xG7"
+//     --output     Archivo de resultados (por defecto selfplay_results.txt)
+//   --bench-search compara la busqueda con 1 hilo y con S hilos (por defecto, los nucleos disponibles)
+//   durante MS milisegundos por posicion (por defecto 2000): nodos por segundo y profundidad alcanzada.
+//   --bench-mcts hace lo mismo con MctsSearch: simulaciones por segundo con 1 arbol y con S arboles.
+//   --bench-eval mide posiciones por segundo de Evaluator::EvaluateBatch (escalar, SSE4.1, AVX2)
+//   frente a llamar a EvaluateBoardState posicion por posicion.
+
+#include "WorkStealingPool.h" // Para repartir las partidas entre hilos
+
+#include "AiPlayer.h"       // Para tratar igual a las IA de los dos motores
+#include "CommonTypes.h"    // Para PlayerColor, GameStats, GameOverReason, MoveInput
+#include "ComputerPlayer.h" // Para la IA de ambos bandos
+#include "EndgameTablebase.h" // Para las tablas de finales compartidas por todos los jugadores
+#include "MctsComputerPlayer.h" // Para la IA con busqueda de arbol Monte Carlo
+#include "MctsSearch.h"     // Para la comparacion de simulaciones por segundo
+#include "OpeningBook.h"    // Para el libro de aperturas compartido por todos los jugadores
+#include "FileHandler.h"    // Para GameResult y FormatGameResultLine
+#include "Evaluator.h"      // Para la comparacion de la evaluacion por lotes
+#include "GameEngine.h"     // Para jugar sin interfaz
+#include "SearchEngine.h"   // Para la comparacion de la busqueda con varios hilos
+#include "TimeManager.h"    // Para TimeControl
+#include "TranspositionTable.h" // Para la tabla compartida de la comparacion
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+	struct SelfPlayOptions {
+		int games = 100;
+		int threads = 0; // 0 = nucleos disponibles
+		int whiteDifficulty = 1;
+		int blackDifficulty = 1;
+		std::string whiteEngine = "alfabeta"; // "alfabeta" o "mcts"
+		std::string blackEngine = "alfabeta";
+		int maxTurns = 200;
+		int hashMb = 4;
+		int searchThreads = 0; // 0 = 1 en las partidas, los nucleos disponibles en --bench-search
+		long long benchTimeMs = 2000;
+		bool benchSearch = false;
+		bool benchMcts = false;
+		bool benchEval = false;
+		TimeControl timeControl; // Inactivo por defecto: la profundidad depende de la dificultad
+		std::string tablebasePath; // Vacio = sin tablas de finales
+		std::string bookPath;      // Vacio = sin libro de aperturas
+		std::string recordPath;    // Vacio = no se graban las jugadas
+		std::string outputPath = "selfplay_results.txt";
+	};
+
+	// Posiciones de la comparacion de busqueda (formato de Board::LoadPositionString)
+	const char* const BENCH_POSITIONS[] = {
+		"W:bbbbbbbbbbbb........wwwwwwwwwwww",
+		"B:bbW.b..b...b.....w.b.....wwwwB..",
+		"W:...b..W.Bbb.....bb.w........w...",
+		"W:..Wb..b..bbw.....b.B.w..w...w...",
+	};
+
+	// Estado propio de cada hilo: un motor y dos jugadores que se reutilizan entre partidas
+	// (la busqueda alfa-beta de ComputerPlayer o MCTS, segun el motor elegido para cada bando)
+	struct WorkerContext {
+		GameEngine engine;
+		std::unique_ptr<AiPlayer> white;
+		std::unique_ptr<AiPlayer> black;
+	};
+
+	// Resultado de una partida: la linea para el archivo, el ganador para el resumen y las jugadas si se graban
+	struct SelfPlayGame {
+		GameResult result;
+		PlayerColor winner = PlayerColor::NONE;
+		std::string moves; // Turnos separados por espacios (vacio si no se usa --record)
+		double thinkingSeconds[2] = { 0.0, 0.0 }; // Tiempo de decision de cada bando (Blancas, Negras)
+		int decisions[2] = { 0, 0 };              // Turnos que jugo cada bando
+	};
+
+	std::string ColorName(PlayerColor color) {
+		return (color == PlayerColor::PLAYER_1) ? "Blancas (w)" : "Negras (b)";
+	}
+
+	std::string PlayerTypeName(const std::string& engineName, int difficulty) {
+		return (engineName == "mcts" ? "Computadora MCTS (" : "Computadora (") + std::to_string(difficulty) + ")";
+	}
+
+	std::string CurrentDateTime(const char* format) {
+		std::time_t now = std::time(nullptr);
+		std::tm nowTm{};
+#ifdef _WIN32
+		localtime_s(&nowTm, &now);
+#else
+		localtime_r(&now, &nowTm);
+#endif
+		std::ostringstream oss;
+		oss << std::put_time(&nowTm, format);
+		return oss.str();
+	}
+
+	// Construye el GameResult con la misma forma que GameManager::AnnounceResult
+	GameResult BuildGameResult(const GameEngine& engine, const SelfPlayOptions& options) {
+		const GameStats& stats = engine.GetStats();
+		GameResult result;
+		result.date = CurrentDateTime("%Y-%m-%d");
+		result.time = CurrentDateTime("%H:%M:%S");
+		result.playerTypes = PlayerTypeName(options.whiteEngine, options.whiteDifficulty) + " vs " +
+			PlayerTypeName(options.blackEngine, options.blackDifficulty);
+
+		PlayerColor winner = stats.winner;
+		PlayerColor loser = (winner == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1;
+		if (winner != PlayerColor::NONE) result.winner = ColorName(winner);
+		else if (stats.reason == GameOverReason::STALEMATE_BY_RULES) result.winner = "EMPATE";
+		else result.winner = "N/A";
+
+		switch (stats.reason) {
+		case GameOverReason::NO_PIECES: result.reason = ColorName(loser) + " se quedo sin fichas."; break;
+		case GameOverReason::NO_MOVES: result.reason = ColorName(loser) + " no tiene movimientos (bloqueado)."; break;
+		case GameOverReason::STALEMATE_BY_RULES: result.reason = "Empate por limite de " + std::to_string(options.maxTurns) + " turnos."; break;
+		default: result.reason = "El juego termino por una condicion no especificada."; break;
+		}
+		result.totalTurns = stats.currentTurnNumber;
+		if (winner == PlayerColor::PLAYER_2) {
+			result.winnerCaptures = stats.player2CapturedCount;
+			result.loserCaptures = stats.player1CapturedCount;
+		}
+		else {
+			result.winnerCaptures = stats.player1CapturedCount;
+			result.loserCaptures = stats.player2CapturedCount;
+		}
+		return result;
+	}
+
+	// Juega una partida completa. La IA recibe los mismos datos que en GameManager y sus movimientos
+	// se validan con el motor; una jugada invalida de la IA cuenta como derrota, igual que en la consola.
+	SelfPlayGame PlayGame(WorkerContext& context, const SelfPlayOptions& options) {
+		GameEngine& engine = context.engine;
+		engine.NewGame();
+		engine.SetMaxTurns(options.maxTurns);
+		context.white->SetTimeControl(options.timeControl);
+		context.black->SetTimeControl(options.timeControl);
+		std::string moves;
+		SelfPlayGame game;
+
+		while (!engine.IsOver()) {
+			if (!engine.CheckCurrentPlayerCanMove()) {
+				break;
+			}
+			PlayerColor current = engine.GetCurrentPlayer();
+			AiPlayer& player = (current == PlayerColor::PLAYER_1) ? *context.white : *context.black;
+			std::chrono::steady_clock::time_point decisionStart = std::chrono::steady_clock::now();
+			MoveInput input = player.GetChosenMoveInput(engine.GetBoard(), engine.GetMoveGenerator(),
+				engine.IsInCaptureSequence(), engine.GetForcedPieceRow(), engine.GetForcedPieceCol(), engine.GetLegalMoveSequences());
+			bool continuesTurn = engine.IsInCaptureSequence();
+			// Solo cuenta la decision del turno: los saltos siguientes de una cadena ya estan planificados
+			if (!continuesTurn) {
+				int side = (current == PlayerColor::PLAYER_1) ? 0 : 1;
+				game.thinkingSeconds[side] += std::chrono::duration<double>(std::chrono::steady_clock::now() - decisionStart).count();
+				++game.decisions[side];
+			}
+			if (!input.isValidFormat ||
+				engine.ApplyMove(input.startRow, input.startCol, input.endRow, input.endCol) != MoveResult::APPLIED) {
+				engine.EndGame((current == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1, GameOverReason::NO_MOVES);
+			}
+			else if (!options.recordPath.empty()) {
+				// Los saltos de una misma cadena se encadenan en el mismo turno
+				const Move& applied = engine.GetLastMove();
+				if (!continuesTurn) {
+					if (!moves.empty()) moves += ' ';
+					moves += ToAlgebraic(applied.startR_, applied.startC_);
+				}
+				moves += applied.isCapture_ ? 'x' : '-';
+				moves += ToAlgebraic(applied.endR_, applied.endC_);
+			}
+		}
+
+		game.result = BuildGameResult(engine, options);
+		game.winner = engine.GetStats().winner;
+		game.moves = std::move(moves);
+		return game;
+	}
+
+	bool ParseOptions(int argc, char* argv[], SelfPlayOptions& options) {
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			if (arg == "--bench-search") {
+				options.benchSearch = true;
+				continue;
+			}
+			if (arg == "--bench-mcts") {
+				options.benchMcts = true;
+				continue;
+			}
+			if (arg == "--bench-eval") {
+				options.benchEval = true;
+				continue;
+			}
+			if (i + 1 >= argc) return false;
+			std::string value = argv[++i];
+			if (arg == "--games") options.games = std::atoi(value.c_str());
+			else if (arg == "--threads") options.threads = std::atoi(value.c_str());
+			else if (arg == "--white") options.whiteDifficulty = std::atoi(value.c_str());
+			else if (arg == "--black") options.blackDifficulty = std::atoi(value.c_str());
+			else if (arg == "--white-engine") options.whiteEngine = value;
+			else if (arg == "--black-engine") options.blackEngine = value;
+			else if (arg == "--max-turns") options.maxTurns = std::atoi(value.c_str());
+			else if (arg == "--hash") options.hashMb = std::atoi(value.c_str());
+			else if (arg == "--search-threads") options.searchThreads = std::atoi(value.c_str());
+			else if (arg == "--time") options.benchTimeMs = std::atoll(value.c_str());
+			else if (arg == "--move-time") options.timeControl.moveTimeMs = std::atoll(value.c_str());
+			else if (arg == "--game-time") options.timeControl.gameTimeMs = std::atoll(value.c_str());
+			else if (arg == "--increment") options.timeControl.incrementMs = std::atoll(value.c_str());
+			else if (arg == "--tablebase") options.tablebasePath = value;
+			else if (arg == "--book") options.bookPath = value;
+			else if (arg == "--record") options.recordPath = value;
+			else if (arg == "--output") options.outputPath = value;
+			else return false;
+		}
+		int cores = static_cast<int>(std::thread::hardware_concurrency());
+		if (cores <= 0) cores = 1;
+		if (options.threads <= 0) options.threads = cores;
+		if (options.searchThreads <= 0) options.searchThreads = (options.benchSearch || options.benchMcts) ? cores : 1;
+		for (const std::string& engineName : { options.whiteEngine, options.blackEngine }) {
+			if (engineName != "alfabeta" && engineName != "mcts") return false;
+		}
+		return options.games > 0 && options.benchTimeMs > 0;
+	}
+
+	// Busca durante un tiempo fijo con 'threads' hilos y una tabla nueva
+	SearchResult TimedSearch(const char* position, int threads, const SelfPlayOptions& options) {
+		Board board;
+		board.LoadPositionString(position);
+		MoveGenerator generator;
+		MoveSequenceList rootMoves;
+		generator.GenerateMoveSequences(board, board.GetSideToMove(), rootMoves);
+		TranspositionTable table(options.hashMb);
+		SearchEngine engine(generator, &table);
+		SearchLimits limits;
+		limits.maxDepth = 64; // Solo limita el tiempo
+		limits.maxTimeMs = options.benchTimeMs;
+		limits.threads = threads;
+		return engine.Search(board, board.GetSideToMove(), rootMoves, limits);
+	}
+
+	double NodesPerSecond(const SearchResult& result) {
+		return (result.seconds > 0) ? result.nodes / result.seconds : 0.0;
+	}
+
+	// Compara 1 hilo con options.searchThreads hilos a tiempo fijo en cada posicion de prueba
+	int RunSearchBenchmark(const SelfPlayOptions& options) {
+		std::cout << "Busqueda a " << options.benchTimeMs << " ms por posicion: 1 hilo contra "
+			<< options.searchThreads << " hilos (tabla de " << options.hashMb << " MB)" << std::endl;
+		double singleNps = 0.0, multiNps = 0.0;
+		int singleDepth = 0, multiDepth = 0;
+		long long betaCutoffs = 0, firstMoveCutoffs = 0;
+		long long singleNodes = 0, quiescenceNodes = 0;
+		for (const char* position : BENCH_POSITIONS) {
+			SearchResult single = TimedSearch(position, 1, options);
+			SearchResult multi = TimedSearch(position, options.searchThreads, options);
+			singleNps += NodesPerSecond(single);
+			multiNps += NodesPerSecond(multi);
+			singleDepth += single.depthReached;
+			multiDepth += multi.depthReached;
+			betaCutoffs += single.betaCutoffs;
+			firstMoveCutoffs += single.firstMoveCutoffs;
+			singleNodes += single.nodes;
+			quiescenceNodes += single.quiescenceNodes;
+			std::cout << position << "  1 hilo: prof. " << single.depthReached << ", "
+				<< static_cast<long long>(NodesPerSecond(single)) << " nodos/s  |  "
+				<< options.searchThreads << " hilos: prof. " << multi.depthReached << ", "
+				<< static_cast<long long>(NodesPerSecond(multi)) << " nodos/s" << std::endl;
+		}
+		int positionCount = static_cast<int>(sizeof(BENCH_POSITIONS) / sizeof(BENCH_POSITIONS[0]));
+		std::cout << "Aceleracion en nodos/s: " << (singleNps > 0 ? multiNps / singleNps : 0.0) << "x" << std::endl;
+		std::cout << "Ganancia media de profundidad: " << static_cast<double>(multiDepth - singleDepth) / positionCount
+			<< " turnos" << std::endl;
+		std::cout << "Cortes beta con el primer movimiento (1 hilo): "
+			<< (betaCutoffs > 0 ? 100.0 * firstMoveCutoffs / betaCutoffs : 0.0) << "% de " << betaCutoffs << std::endl;
+		std::cout << "Nodos de quiescencia (1 hilo): "
+			<< (singleNodes > 0 ? 100.0 * quiescenceNodes / singleNodes : 0.0) << "% de " << singleNodes << std::endl;
+		return 0;
+	}
+
+	// Simula durante options.benchTimeMs con 'threads' arboles y una semilla fija
+	MctsResult TimedMctsSearch(const char* position, int threads, const SelfPlayOptions& options) {
+		Board board;
+		board.LoadPositionString(position);
+		MoveGenerator generator;
+		MoveSequenceList rootMoves;
+		generator.GenerateMoveSequences(board, board.GetSideToMove(), rootMoves);
+		MctsSearch search(generator);
+		search.SetRandomSeed(12345);
+		MctsLimits limits;
+		limits.maxTimeMs = options.benchTimeMs;
+		limits.threads = threads;
+		return search.Search(board, board.GetSideToMove(), rootMoves, limits);
+	}
+
+	double PlayoutsPerSecond(const MctsResult& result) {
+		return (result.seconds > 0) ? result.playouts / result.seconds : 0.0;
+	}
+
+	// Compara 1 arbol con options.searchThreads arboles a tiempo fijo en cada posicion de prueba
+	int RunMctsBenchmark(const SelfPlayOptions& options) {
+		std::cout << "MCTS a " << options.benchTimeMs << " ms por posicion: 1 arbol contra "
+			<< options.searchThreads << " arboles" << std::endl;
+		double singleRate = 0.0, multiRate = 0.0;
+		for (const char* position : BENCH_POSITIONS) {
+			MctsResult single = TimedMctsSearch(position, 1, options);
+			MctsResult multi = TimedMctsSearch(position, options.searchThreads, options);
+			singleRate += PlayoutsPerSecond(single);
+			multiRate += PlayoutsPerSecond(multi);
+			std::cout << position << "  1 arbol: " << static_cast<long long>(PlayoutsPerSecond(single)) << " simulaciones/s, "
+				<< single.treeNodes << " nodos  |  " << options.searchThreads << " arboles: "
+				<< static_cast<long long>(PlayoutsPerSecond(multi)) << " simulaciones/s" << std::endl;
+		}
+		int positionCount = static_cast<int>(sizeof(BENCH_POSITIONS) / sizeof(BENCH_POSITIONS[0]));
+		std::cout << "Media con 1 arbol: " << static_cast<long long>(singleRate / positionCount) << " simulaciones/s" << std::endl;
+		std::cout << "Aceleracion en simulaciones/s: " << (singleRate > 0 ? multiRate / singleRate : 0.0) << "x" << std::endl;
+		return 0;
+	}
+
+	// Crea la IA de un bando con el motor elegido; las tablas y el libro solo los usa la busqueda alfa-beta
+	std::unique_ptr<AiPlayer> CreateSidePlayer(PlayerColor color, const std::string& engineName, int difficulty, const MoveGenerator& generator,
+		const SelfPlayOptions& options, const EndgameTablebase& tablebase, const OpeningBook& openingBook) {
+		std::unique_ptr<AiPlayer> side;
+		if (engineName == "mcts") {
+			side.reset(new MctsComputerPlayer(color, generator, difficulty));
+		}
+		else {
+			std::unique_ptr<ComputerPlayer> alphaBeta(new ComputerPlayer(color, generator, difficulty, options.hashMb));
+			if (tablebase.IsLoaded()) {
+				alphaBeta->SetEndgameTablebase(&tablebase);
+			}
+			if (openingBook.IsLoaded()) {
+				alphaBeta->SetOpeningBook(&openingBook);
+			}
+			side = std::move(alphaBeta);
+		}
+		side->SetThinkingDelayEnabled(false);
+		side->SetSearchThreads(options.searchThreads);
+		return side;
+	}
+
+	// Posiciones de partidas al azar (semilla fija), con el turno del bando que mueve
+	std::vector<Board> RandomGamePositions(std::size_t count) {
+		std::vector<Board> positions;
+		positions.reserve(count);
+		MoveGenerator generator;
+		std::mt19937 rng(12345);
+		while (positions.size() < count) {
+			Board board;
+			board.InitializeBoard();
+			MoveSequenceList moves;
+			generator.GenerateMoveSequences(board, board.GetSideToMove(), moves);
+			while (!moves.empty() && positions.size() < count) {
+				const MoveSequence& move = moves[static_cast<int>(rng() % static_cast<unsigned>(moves.size()))];
+				for (int step = 0; step < move.numSteps_; ++step) {
+					board.MakeMove(move.GetCompactStep(step));
+				}
+				board.SetSideToMove((move.playerColor_ == PlayerColor::PLAYER_1) ? PlayerColor::PLAYER_2 : PlayerColor::PLAYER_1);
+				positions.push_back(board);
+				generator.GenerateMoveSequences(board, board.GetSideToMove(), moves);
+			}
+		}
+		return positions;
+	}
+
+	// Mide posiciones por segundo de 'evaluate' repitiendo la pasada sobre todas las posiciones
+	template <typename EvaluateAll>
+	double PositionsPerSecond(std::size_t positionCount, EvaluateAll evaluateAll) {
+		const int repetitions = 50;
+		auto start = std::chrono::steady_clock::now();
+		for (int repetition = 0; repetition < repetitions; ++repetition) {
+			evaluateAll();
+		}
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		return (seconds > 0) ? positionCount * static_cast<double>(repetitions) / seconds : 0.0;
+	}
+
+	// Compara la evaluacion por lotes con la evaluacion posicion por posicion y comprueba que coinciden
+	int RunEvaluationBenchmark() {
+		const std::size_t positionCount = 100000;
+		std::vector<Board> positions = RandomGamePositions(positionCount);
+		Evaluator evaluator;
+		std::vector<int> expected(positionCount), batch(positionCount);
+		long long checksum = 0;
+
+		double singleRate = PositionsPerSecond(positionCount, [&]() {
+			for (std::size_t i = 0; i < positionCount; ++i) {
+				expected[i] = evaluator.EvaluateBoardState(positions[i], positions[i].GetSideToMove());
+			}
+			checksum += expected[0];
+		});
+		std::cout << "Posiciones: " << positionCount << "  (mejor nivel del procesador: "
+			<< Evaluator::SimdLevelName(Evaluator::DetectSimdLevel()) << ")" << std::endl;
+		std::cout << "EvaluateBoardState una a una: " << static_cast<long long>(singleRate) << " posiciones/s" << std::endl;
+
+		bool allMatch = true;
+		double scalarRate = 0.0;
+		for (Evaluator::SimdLevel level : { Evaluator::SimdLevel::SCALAR, Evaluator::SimdLevel::SSE41, Evaluator::SimdLevel::AVX2 }) {
+			if (level > Evaluator::DetectSimdLevel()) {
+				continue;
+			}
+			double rate = PositionsPerSecond(positionCount, [&]() {
+				evaluator.EvaluateBatch(positions.data(), positionCount, batch.data(), level);
+				checksum += batch[0];
+			});
+			if (level == Evaluator::SimdLevel::SCALAR) {
+				scalarRate = rate;
+			}
+			bool match = (batch == expected);
+			allMatch = allMatch && match;
+			std::cout << "EvaluateBatch " << Evaluator::SimdLevelName(level) << ": " << static_cast<long long>(rate)
+				<< " posiciones/s  (" << (scalarRate > 0 ? rate / scalarRate : 0.0) << "x frente al lote escalar)"
+				<< (match ? "" : "  [RESULTADOS DISTINTOS]") << std::endl;
+		}
+		std::cout << (allMatch ? "Todos los resultados coinciden con EvaluateBoardState." : "Hay resultados que no coinciden.")
+			<< "  (control " << checksum << ")" << std::endl;
+		return allMatch ? 0 : 1;
+	}
+}
+
+// Funcion principal
+int main(int argc, char* argv[]) {
+	SelfPlayOptions options;
+	if (!ParseOptions(argc, argv, options)) {
+		std::cerr << "Uso: SelfPlay [--games N] [--threads T] [--white D] [--black D] [--white-engine E] [--black-engine E]" << std::endl;
+		std::cerr << "              [--max-turns M] [--hash MB] [--search-threads S]" << std::endl;
+		std::cerr << "              [--move-time MS | --game-time MS [--increment MS]] [--tablebase archivo] [--book archivo]" << std::endl;
+		std::cerr << "              [--record archivo] [--output archivo]" << std::endl;
+		std::cerr << "     SelfPlay --bench-search [--search-threads S] [--time MS] [--hash MB]" << std::endl;
+		std::cerr << "     SelfPlay --bench-mcts [--search-threads S] [--time MS]" << std::endl;
+		std::cerr << "     SelfPlay --bench-eval" << std::endl;
+		std::cerr << "     E = alfabeta | mcts" << std::endl;
+		return 1;
+	}
+	if (options.benchEval) {
+		return RunEvaluationBenchmark();
+	}
+	if (options.benchSearch) {
+		return RunSearchBenchmark(options);
+	}
+	if (options.benchMcts) {
+		return RunMctsBenchmark(options);
+	}
+
+	// Las tablas y el libro se proyectan una vez y los consultan todos los hilos (solo lectura)
+	EndgameTablebase tablebase;
+	if (!options.tablebasePath.empty() && !tablebase.Load(options.tablebasePath)) {
+		std::cerr << "No se pudieron cargar las tablas de finales: " << options.tablebasePath << std::endl;
+		return 1;
+	}
+	OpeningBook openingBook;
+	if (!options.bookPath.empty() && !openingBook.Load(options.bookPath)) {
+		std::cerr << "No se pudo cargar el libro de aperturas: " << options.bookPath << std::endl;
+		return 1;
+	}
+
+	// Un contexto por hilo; los jugadores usan el generador del motor de su propio hilo
+	std::vector<std::unique_ptr<WorkerContext>> contexts;
+	for (int worker = 0; worker < options.threads; ++worker) {
+		std::unique_ptr<WorkerContext> context(new WorkerContext());
+		context->white = CreateSidePlayer(PlayerColor::PLAYER_1, options.whiteEngine, options.whiteDifficulty,
+			context->engine.GetMoveGenerator(), options, tablebase, openingBook);
+		context->black = CreateSidePlayer(PlayerColor::PLAYER_2, options.blackEngine, options.blackDifficulty,
+			context->engine.GetMoveGenerator(), options, tablebase, openingBook);
+		contexts.push_back(std::move(context));
+	}
+
+	std::vector<SelfPlayGame> games(options.games);
+	auto start = std::chrono::steady_clock::now();
+	WorkStealingPool::Run(options.games, options.threads, [&](int gameIndex, int worker) {
+		games[gameIndex] = PlayGame(*contexts[worker], options);
+	});
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// Los resultados se escriben en orden de partida al terminar, para no mezclar lineas entre hilos
+	std::ofstream output(options.outputPath, std::ios::app);
+	if (!output.is_open()) {
+		std::cerr << "No se pudo abrir el archivo de resultados: " << options.outputPath << std::endl;
+		return 1;
+	}
+	int whiteWins = 0, draws = 0, blackWins = 0;
+	double thinkingSeconds[2] = { 0.0, 0.0 };
+	long long decisions[2] = { 0, 0 };
+	for (const SelfPlayGame& game : games) {
+		for (int side = 0; side < 2; ++side) {
+			thinkingSeconds[side] += game.thinkingSeconds[side];
+			decisions[side] += game.decisions[side];
+		}
+		output << FormatGameResultLine(game.result) << std::endl;
+		if (game.winner == PlayerColor::PLAYER_1) ++whiteWins;
+		else if (game.winner == PlayerColor::PLAYER_2) ++blackWins;
+		else ++draws;
+	}
+	if (!options.recordPath.empty()) {
+		std::ofstream record(options.recordPath, std::ios::app);
+		if (!record.is_open()) {
+			std::cerr << "No se pudo abrir el archivo de jugadas: " << options.recordPath << std::endl;
+			return 1;
+		}
+		for (const SelfPlayGame& game : games) {
+			const char* result = (game.winner == PlayerColor::PLAYER_1) ? "1-0" : (game.winner == PlayerColor::PLAYER_2) ? "0-1" : "1/2";
+			record << result << ' ' << game.moves << std::endl;
+		}
+	}
+
+	std::cout << "Partidas: " << options.games << "  Hilos: " << options.threads
+		<< "  Dificultad: Blancas " << options.whiteDifficulty << " / Negras " << options.blackDifficulty << std::endl;
+	std::cout << "Tiempo: " << seconds << " s  (" << (seconds > 0 ? options.games / seconds : 0.0) << " partidas/s)" << std::endl;
+	std::cout << "Blancas ganan: " << whiteWins << "  Empates: " << draws << "  Negras ganan: " << blackWins << std::endl;
+	std::cout << "Tiempo medio por jugada: Blancas (" << options.whiteEngine << ") "
+		<< (decisions[0] > 0 ? 1000.0 * thinkingSeconds[0] / decisions[0] : 0.0) << " ms, Negras (" << options.blackEngine << ") "
+		<< (decisions[1] > 0 ? 1000.0 * thinkingSeconds[1] / decisions[1] : 0.0) << " ms" << std::endl;
+	std::cout << "Resultados guardados en " << options.outputPath << std::endl;
+	if (!options.recordPath.empty()) {
+		std::cout << "Jugadas guardadas en " << options.recordPath << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,73 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Reparto de un lote de tareas independientes entre varios hilos con robo de trabajo.
+// Cada hilo tiene su propia cola: toma tareas del final de la suya y, cuando se queda sin trabajo,
+// roba del principio de la cola de otro hilo. Asi las partidas largas no dejan hilos ociosos.
+class WorkStealingPool {
+public:
+	// Ejecuta task(indiceTarea, indiceHilo) para cada tarea de [0, taskCount) con 'threadCount' hilos.
+	// Vuelve cuando todas las tareas terminaron. Cada hilo tiene un indice fijo para usar su propio estado.
+	static void Run(int taskCount, int threadCount, const std::function<void(int, int)>& task) {
+		if (threadCount < 1) threadCount = 1;
+		std::vector<WorkerQueue> queues(threadCount);
+		// Reparto inicial alternado para que cada cola tenga una mezcla de tareas
+		for (int i = 0; i < taskCount; ++i) {
+			queues[i % threadCount].tasks.push_back(i);
+		}
+
+		std::vector<std::thread> workers;
+		for (int worker = 1; worker < threadCount; ++worker) {
+			workers.emplace_back(WorkerLoop, std::ref(queues), worker, std::cref(task));
+		}
+		WorkerLoop(queues, 0, task); // El hilo llamador tambien trabaja
+		for (std::thread& thread : workers) {
+			thread.join();
+		}
+	}
+
+private:
+	struct WorkerQueue {
+		std::mutex mutex;
+		std::deque<int> tasks;
+	};
+
+	// Saca una tarea de la cola propia (por el final) o roba una de otra cola (por el principio).
+	// Como no se agregan tareas nuevas, si todas las colas estan vacias el trabajo termino.
+	static bool NextTask(std::vector<WorkerQueue>& queues, int worker, int& outTask) {
+		{
+			std::lock_guard<std::mutex> lock(queues[worker].mutex);
+			if (!queues[worker].tasks.empty()) {
+				outTask = queues[worker].tasks.back();
+				queues[worker].tasks.pop_back();
+				return true;
+			}
+		}
+		int count = static_cast<int>(queues.size());
+		for (int offset = 1; offset < count; ++offset) {
+			WorkerQueue& victim = queues[(worker + offset) % count];
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if (!victim.tasks.empty()) {
+				outTask = victim.tasks.front();
+				victim.tasks.pop_front();
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static void WorkerLoop(std::vector<WorkerQueue>& queues, int worker, const std::function<void(int, int)>& task) {
+		int taskIndex = 0;
+		while (NextTask(queues, worker, taskIndex)) {
+			task(taskIndex, worker);
+		}
+	}
+};
+
+#endif // WORK_STEALING_POOL_H
@@ -0,0 +1,509 @@
+// Generador de las tablas de finales por analisis retrogrado.
+// Calcula el resultado exacto (victoria, derrota o tablas) y la distancia al final de la partida de todas
+// las posiciones con hasta N piezas, con las mismas reglas que el juego (usa MoveGenerator): los peones
+// avanzan y capturan solo hacia delante, las Damas se mueven un paso, la captura es obligatoria y la
+// captura con Dama tiene prioridad. Un bando sin piezas o sin movimientos pierde.
+// Las tablas de cada cantidad de piezas dependen solo de las de menos piezas (una captura retira piezas),
+// asi que se generan de menos a mas piezas y cada capa se resuelve por niveles de distancia.
+//
+// Uso:
+//   Tablebase [--pieces N] [--output archivo]  Genera las tablas hasta N piezas (por defecto 5) en el archivo
+//                                              (por defecto damas_endgame.tb)
+//   Tablebase --verify [archivo]               Comprueba que el valor de cada posicion del archivo sea coherente
+//                                              con los de sus sucesores (codigo de salida 1 si alguno no lo es)
+
+#include "Board.h"            // Para Board
+#include "CommonTypes.h"      // Para PlayerColor, PieceType
+#include "EndgameTablebase.h" // Para el indexado y el formato del archivo
+#include "MoveGenerator.h"    // Para las reglas de movimiento
+#include "MoveSequence.h"     // Para MoveSequence y MoveSequenceList
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+	const std::uint8_t NOT_SCHEDULED = 0xFF; // La posicion no tiene revision pendiente
+
+	double SecondsSince(std::chrono::steady_clock::time_point start) {
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Un peon en su fila de coronacion no puede aparecer en una partida
+	bool IsReachable(const NormalizedPosition& position) {
+		return (position.ownMen & BITBOARD_ROW_0) == 0 && (position.opponentMen & BITBOARD_ROW_7) == 0;
+	}
+
+	// Tablero reutilizable para generar movimientos de posiciones normalizadas (el bando que mueve es PLAYER_1).
+	// Solo se tocan las casillas que cambian respecto a la posicion anterior.
+	class ScratchBoard {
+	public:
+		ScratchBoard() : mOccupied(0) {
+			for (int square = 0; square < Board::NUM_PLAYABLE_SQUARES; ++square) {
+				mBoard.SetPieceAtSquare(square, PieceType::EMPTY);
+			}
+		}
+
+		Board& Load(const NormalizedPosition& position) {
+			while (mOccupied) {
+				mBoard.SetPieceAtSquare(PopLowestBit(mOccupied), PieceType::EMPTY);
+			}
+			Place(position.ownMen, PieceType::P1_MAN);
+			Place(position.ownKings, PieceType::P1_KING);
+			Place(position.opponentMen, PieceType::P2_MAN);
+			Place(position.opponentKings, PieceType::P2_KING);
+			mBoard.SetSideToMove(PlayerColor::PLAYER_1);
+			return mBoard;
+		}
+
+	private:
+		Board mBoard;
+		Bitboard mOccupied; // Casillas ocupadas por la ultima posicion cargada
+
+		void Place(Bitboard pieces, PieceType piece) {
+			mOccupied |= pieces;
+			while (pieces) {
+				mBoard.SetPieceAtSquare(PopLowestBit(pieces), piece);
+			}
+		}
+	};
+
+	// Posicion a la que lleva un movimiento completo del bando que mueve, vista por el rival
+	// (que es quien mueve en ella)
+	NormalizedPosition ApplySequence(const NormalizedPosition& position, const MoveSequence& move) {
+		Bitboard from = SquareBit(move.startSquare_);
+		Bitboard to = SquareBit(move.GetEndSquare());
+		Bitboard captured = move.GetCapturedMask();
+		NormalizedPosition next = position;
+		next.ownMen &= ~from;
+		next.ownKings &= ~from;
+		if (move.pieceMoved_ == PieceType::P1_KING || move.promotionStep_ >= 0) {
+			next.ownKings |= to;
+		}
+		else {
+			next.ownMen |= to;
+		}
+		next.opponentMen &= ~captured;
+		next.opponentKings &= ~captured;
+		return EndgameTablebase::Flip(next);
+	}
+
+	// Todas las firmas con exactamente 'pieces' piezas y al menos una pieza por bando
+	std::vector<MaterialSignature> SignaturesWithPieces(int pieces) {
+		std::vector<MaterialSignature> signatures;
+		for (int ownMen = 0; ownMen <= pieces; ++ownMen) {
+			for (int ownKings = 0; ownMen + ownKings <= pieces; ++ownKings) {
+				for (int opponentMen = 0; ownMen + ownKings + opponentMen <= pieces; ++opponentMen) {
+					MaterialSignature signature;
+					signature.ownMen = ownMen;
+					signature.ownKings = ownKings;
+					signature.opponentMen = opponentMen;
+					signature.opponentKings = pieces - ownMen - ownKings - opponentMen;
+					if (ownMen + ownKings > 0 && opponentMen + signature.opponentKings > 0) {
+						signatures.push_back(signature);
+					}
+				}
+			}
+		}
+		return signatures;
+	}
+
+	// Generacion de las tablas en memoria
+	class TablebaseGenerator {
+	public:
+		explicit TablebaseGenerator(int maxPieces)
+			: mMaxPieces(maxPieces),
+			mTableByCode(EndgameTablebase::SIGNATURE_CODE_COUNT, -1) {
+		}
+
+		// Resuelve las capas de 2 a N piezas. Devuelve false si alguna distancia no cabe en el formato.
+		bool Generate() {
+			for (int pieces = 2; pieces <= mMaxPieces; ++pieces) {
+				if (!SolveLayer(pieces)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool Write(const std::string& path) const {
+			std::ofstream output(path, std::ios::binary);
+			if (!output) {
+				return false;
+			}
+			output.write(EndgameTablebase::FILE_MAGIC, 8);
+			WriteUint32(output, static_cast<std::uint32_t>(mMaxPieces));
+			WriteUint32(output, static_cast<std::uint32_t>(mTables.size()));
+			std::uint64_t offset = EndgameTablebase::HEADER_SIZE + mTables.size() * EndgameTablebase::DIRECTORY_ENTRY_SIZE;
+			for (const SignatureTable& table : mTables) {
+				char material[4] = {
+					static_cast<char>(table.signature.ownMen), static_cast<char>(table.signature.ownKings),
+					static_cast<char>(table.signature.opponentMen), static_cast<char>(table.signature.opponentKings)
+				};
+				output.write(material, 4);
+				WriteUint64(output, offset);
+				WriteUint64(output, table.values.size());
+				offset += table.values.size();
+			}
+			for (const SignatureTable& table : mTables) {
+				output.write(reinterpret_cast<const char*>(table.values.data()), static_cast<std::streamsize>(table.values.size()));
+			}
+			return static_cast<bool>(output);
+		}
+
+	private:
+		struct SignatureTable {
+			MaterialSignature signature;
+			std::vector<std::uint8_t> values;   // Valor de cada posicion (ver EndgameTablebase::EncodeWin)
+			std::vector<std::uint8_t> schedule; // Nivel en que hay que revisar cada posicion (solo mientras se resuelve su capa)
+		};
+
+		int mMaxPieces;
+		std::vector<SignatureTable> mTables;
+		std::vector<int> mTableByCode; // Indice en mTables de cada firma (-1 si no se genero)
+		MoveGenerator mMoveGenerator;
+		ScratchBoard mScratch;
+		int mLastScheduled = 0; // Nivel mas alto con posiciones pendientes en la capa actual
+		bool mDistanceOverflow = false;
+
+		static void WriteUint32(std::ofstream& output, std::uint32_t value) {
+			char bytes[4];
+			for (int i = 0; i < 4; ++i) bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+			output.write(bytes, 4);
+		}
+
+		static void WriteUint64(std::ofstream& output, std::uint64_t value) {
+			WriteUint32(output, static_cast<std::uint32_t>(value));
+			WriteUint32(output, static_cast<std::uint32_t>(value >> 32));
+		}
+
+		SignatureTable& TableFor(const NormalizedPosition& position) {
+			return mTables[mTableByCode[EndgameTablebase::SignatureCode(EndgameTablebase::GetSignature(position))]];
+		}
+
+		// Valor de una posicion ya normalizada; un bando que se quedo sin piezas ha perdido
+		std::uint8_t ValueOf(const NormalizedPosition& position) {
+			if ((position.ownMen | position.ownKings) == 0) {
+				return EndgameTablebase::EncodeLoss(0);
+			}
+			return TableFor(position).values[EndgameTablebase::IndexOf(position)];
+		}
+
+		// Pide revisar una posicion en el nivel indicado (si no estaba resuelta ni pendiente antes)
+		void Schedule(SignatureTable& table, std::uint64_t index, int level) {
+			if (table.values[index] != EndgameTablebase::DRAW_VALUE) {
+				return;
+			}
+			if (level > EndgameTablebase::MAX_DISTANCE) {
+				mDistanceOverflow = true;
+				return;
+			}
+			if (table.schedule[index] == NOT_SCHEDULED || table.schedule[index] > level) {
+				table.schedule[index] = static_cast<std::uint8_t>(level);
+				mLastScheduled = std::max(mLastScheduled, level);
+			}
+		}
+
+		// Al resolverse una posicion hay que revisar las que llegan a ella con un movimiento simple del rival
+		// (las capturas vienen de capas con mas piezas, que todavia no se generaron). Se generan los
+		// movimientos hacia atras sin comprobar la captura obligatoria: revisar una posicion de mas no cambia
+		// su valor, solo cuesta tiempo.
+		void SchedulePredecessors(const NormalizedPosition& position, int level) {
+			Bitboard empty = ~(position.ownMen | position.ownKings | position.opponentMen | position.opponentKings);
+			const Direction backwardForMen[2] = { Direction::UP_LEFT, Direction::UP_RIGHT }; // El rival avanza hacia la fila 7
+			const Direction allDirections[4] = { Direction::UP_LEFT, Direction::UP_RIGHT, Direction::DOWN_LEFT, Direction::DOWN_RIGHT };
+
+			Bitboard men = position.opponentMen;
+			while (men) {
+				Bitboard to = SquareBit(PopLowestBit(men));
+				for (Direction dir : backwardForMen) {
+					Bitboard from = ShiftBitboard(to, dir) & empty;
+					if (from) {
+						NormalizedPosition previous = position;
+						previous.opponentMen ^= to | from;
+						SchedulePosition(EndgameTablebase::Flip(previous), level);
+					}
+				}
+			}
+			Bitboard kings = position.opponentKings;
+			while (kings) {
+				Bitboard to = SquareBit(PopLowestBit(kings));
+				for (Direction dir : allDirections) {
+					Bitboard from = ShiftBitboard(to, dir) & empty;
+					if (from) {
+						NormalizedPosition previous = position;
+						previous.opponentKings ^= to | from;
+						SchedulePosition(EndgameTablebase::Flip(previous), level);
+					}
+				}
+				// Una Dama en la fila de coronacion del rival pudo ser un peon que acaba de coronar
+				if (to & BITBOARD_ROW_7) {
+					for (Direction dir : backwardForMen) {
+						Bitboard from = ShiftBitboard(to, dir) & empty;
+						if (from) {
+							NormalizedPosition previous = position;
+							previous.opponentKings &= ~to;
+							previous.opponentMen |= from;
+							SchedulePosition(EndgameTablebase::Flip(previous), level);
+						}
+					}
+				}
+			}
+		}
+
+		void SchedulePosition(const NormalizedPosition& position, int level) {
+			if (IsReachable(position)) {
+				Schedule(TableFor(position), EndgameTablebase::IndexOf(position), level);
+			}
+		}
+
+		// Revisa una posicion en el nivel 'level' (las posiciones resueltas en este nivel tienen distancia 'level').
+		// Gana si algun movimiento deja al rival en una derrota de distancia level - 1; pierde si todos los
+		// movimientos dejan al rival ganando y la victoria mas larga es de distancia level - 1.
+		// Si un sucesor conocido determina un nivel posterior, la posicion se deja pendiente para ese nivel.
+		void Revise(SignatureTable& table, std::uint64_t index, int level) {
+			NormalizedPosition position = EndgameTablebase::PositionAt(table.signature, index);
+			MoveSequenceList moves;
+			mMoveGenerator.GenerateMoveSequences(mScratch.Load(position), PlayerColor::PLAYER_1, moves);
+
+			int shortestLoss = -1; // Derrota mas corta que se le puede dejar al rival
+			int longestWin = -1;   // Victoria mas larga del rival
+			bool unresolvedChild = false;
+			for (const MoveSequence& move : moves) {
+				TablebaseResult child = EndgameTablebase::DecodeValue(ValueOf(ApplySequence(position, move)));
+				if (child.outcome == TablebaseOutcome::LOSS) {
+					if (shortestLoss < 0 || child.distance < shortestLoss) shortestLoss = child.distance;
+				}
+				else if (child.outcome == TablebaseOutcome::WIN) {
+					longestWin = std::max(longestWin, child.distance);
+				}
+				else {
+					unresolvedChild = true;
+				}
+			}
+
+			int resolvedValue = -1;
+			if (shortestLoss >= 0) {
+				if (shortestLoss + 1 <= level) {
+					resolvedValue = EndgameTablebase::EncodeWin(shortestLoss + 1);
+				}
+				else {
+					Schedule(table, index, shortestLoss + 1);
+				}
+			}
+			else if (!unresolvedChild) {
+				if (longestWin + 1 <= level) {
+					resolvedValue = EndgameTablebase::EncodeLoss(longestWin + 1);
+				}
+				else {
+					Schedule(table, index, longestWin + 1);
+				}
+			}
+
+			if (resolvedValue >= 0) {
+				table.values[index] = static_cast<std::uint8_t>(resolvedValue);
+				SchedulePredecessors(position, level + 1);
+			}
+		}
+
+		bool SolveLayer(int pieces) {
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			std::vector<int> layer;
+			for (const MaterialSignature& signature : SignaturesWithPieces(pieces)) {
+				SignatureTable table;
+				table.signature = signature;
+				table.values.assign(EndgameTablebase::SignatureSize(signature), EndgameTablebase::DRAW_VALUE);
+				table.schedule.assign(table.values.size(), NOT_SCHEDULED);
+				mTableByCode[EndgameTablebase::SignatureCode(signature)] = static_cast<int>(mTables.size());
+				layer.push_back(static_cast<int>(mTables.size()));
+				mTables.push_back(std::move(table));
+			}
+
+			// Nivel 0: las posiciones sin movimientos estan perdidas; el resto se revisa en el nivel 1
+			std::uint64_t positions = 0;
+			for (int tableIndex : layer) {
+				SignatureTable& table = mTables[tableIndex];
+				for (std::uint64_t index = 0; index < table.values.size(); ++index) {
+					NormalizedPosition position = EndgameTablebase::PositionAt(table.signature, index);
+					if (!IsReachable(position)) {
+						continue;
+					}
+					++positions;
+					if (mMoveGenerator.HasAnyValidMoves(mScratch.Load(position), PlayerColor::PLAYER_1)) {
+						table.schedule[index] = 1;
+					}
+					else {
+						table.values[index] = EndgameTablebase::EncodeLoss(0);
+					}
+				}
+			}
+
+			// Niveles 1, 2, ...: solo se revisan las posiciones pendientes de cada nivel
+			mLastScheduled = 1;
+			int level = 1;
+			for (; level <= mLastScheduled; ++level) {
+				for (int tableIndex : layer) {
+					SignatureTable& table = mTables[tableIndex];
+					for (std::uint64_t index = 0; index < table.schedule.size(); ++index) {
+						if (table.schedule[index] == level) {
+							table.schedule[index] = NOT_SCHEDULED;
+							Revise(table, index, level);
+						}
+					}
+				}
+				if (mDistanceOverflow) {
+					std::cerr << "Hay distancias mayores que " << EndgameTablebase::MAX_DISTANCE << " turnos; el formato no las admite." << std::endl;
+					return false;
+				}
+			}
+
+			std::uint64_t wins = 0, losses = 0;
+			int longestDistance = 0;
+			for (int tableIndex : layer) {
+				SignatureTable& table = mTables[tableIndex];
+				for (std::uint8_t value : table.values) {
+					TablebaseResult result = EndgameTablebase::DecodeValue(value);
+					if (result.outcome == TablebaseOutcome::WIN) ++wins;
+					else if (result.outcome == TablebaseOutcome::LOSS) ++losses;
+					longestDistance = std::max(longestDistance, result.distance);
+				}
+				std::vector<std::uint8_t>().swap(table.schedule);
+			}
+			std::cout << pieces << " piezas: " << layer.size() << " firmas, " << positions << " posiciones, "
+				<< wins << " ganadas, " << losses << " perdidas, " << (positions - wins - losses) << " tablas, "
+				<< "distancia maxima " << longestDistance << ", " << (level - 1) << " niveles, "
+				<< SecondsSince(start) << " s" << std::endl;
+			return true;
+		}
+	};
+
+	// Recorre todas las posiciones del archivo a traves de EndgameTablebase::Probe (con las Blancas y,
+	// giradas, con las Negras al turno) y comprueba cada valor contra los de sus sucesores
+	int RunVerify(const std::string& path) {
+		EndgameTablebase tablebase;
+		if (!tablebase.Load(path)) {
+			std::cerr << "No se pudo cargar " << path << std::endl;
+			return 1;
+		}
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		MoveGenerator generator;
+		ScratchBoard scratch;
+		std::uint64_t checked = 0;
+		std::uint64_t failures = 0;
+		for (int pieces = 2; pieces <= tablebase.GetMaxPieces(); ++pieces) {
+			for (const MaterialSignature& signature : SignaturesWithPieces(pieces)) {
+				std::uint64_t size = EndgameTablebase::SignatureSize(signature);
+				for (std::uint64_t index = 0; index < size; ++index) {
+					NormalizedPosition position = EndgameTablebase::PositionAt(signature, index);
+					if (!IsReachable(position)) {
+						continue;
+					}
+					++checked;
+					Board board = scratch.Load(EndgameTablebase::Flip(position));
+					TablebaseResult result;
+					if (!tablebase.Probe(board, PlayerColor::PLAYER_2, result)) {
+						++failures;
+						continue;
+					}
+
+					board = scratch.Load(position);
+					TablebaseResult sameResult;
+					tablebase.Probe(board, PlayerColor::PLAYER_1, sameResult);
+					MoveSequenceList moves;
+					generator.GenerateMoveSequences(board, PlayerColor::PLAYER_1, moves);
+					int shortestLoss = -1;
+					int longestWin = -1;
+					bool drawnChild = false;
+					for (const MoveSequence& move : moves) {
+						NormalizedPosition next = ApplySequence(position, move);
+						TablebaseResult child;
+						if ((next.ownMen | next.ownKings) == 0) {
+							child.outcome = TablebaseOutcome::LOSS;
+						}
+						else {
+							tablebase.Probe(scratch.Load(next), PlayerColor::PLAYER_1, child);
+						}
+						if (child.outcome == TablebaseOutcome::LOSS) {
+							if (shortestLoss < 0 || child.distance < shortestLoss) shortestLoss = child.distance;
+						}
+						else if (child.outcome == TablebaseOutcome::WIN) {
+							longestWin = std::max(longestWin, child.distance);
+						}
+						else {
+							drawnChild = true;
+						}
+					}
+
+					bool consistent = (sameResult.outcome == result.outcome && sameResult.distance == result.distance);
+					if (moves.empty()) {
+						consistent = consistent && result.outcome == TablebaseOutcome::LOSS && result.distance == 0;
+					}
+					else if (result.outcome == TablebaseOutcome::WIN) {
+						consistent = consistent && shortestLoss >= 0 && result.distance == shortestLoss + 1;
+					}
+					else if (result.outcome == TablebaseOutcome::LOSS) {
+						consistent = consistent && shortestLoss < 0 && !drawnChild && result.distance == longestWin + 1;
+					}
+					else {
+						consistent = consistent && shortestLoss < 0 && drawnChild;
+					}
+					if (!consistent) {
+						if (failures < 10) {
+							std::cerr << "Valor incoherente: " << board.ToPositionString() << std::endl;
+						}
+						++failures;
+					}
+				}
+			}
+		}
+		std::cout << "Posiciones comprobadas: " << checked << "  incoherentes: " << failures
+			<< "  " << SecondsSince(start) << " s" << std::endl;
+		return (failures == 0) ? 0 : 1;
+	}
+}
+
+// Funcion principal
+int main(int argc, char* argv[]) {
+	int maxPieces = 5;
+	std::string outputPath = EndgameTablebase::DEFAULT_FILENAME;
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg == "--verify") {
+			return RunVerify((i + 1 < argc) ? argv[i + 1] : EndgameTablebase::DEFAULT_FILENAME);
+		}
+		if (i + 1 >= argc) {
+			maxPieces = 0; // Opcion sin valor
+			break;
+		}
+		std::string value = argv[++i];
+		if (arg == "--pieces") maxPieces = std::atoi(value.c_str());
+		else if (arg == "--output") outputPath = value;
+		else {
+			maxPieces = 0;
+			break;
+		}
+	}
+	if (maxPieces < 2 || maxPieces > EndgameTablebase::MAX_SUPPORTED_PIECES) {
+		std::cerr << "Uso: Tablebase [--pieces N] [--output archivo] | --verify [archivo]" << std::endl;
+		std::cerr << "     N entre 2 y " << EndgameTablebase::MAX_SUPPORTED_PIECES << std::endl;
+		return 1;
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	TablebaseGenerator generator(maxPieces);
+	if (!generator.Generate()) {
+		return 1;
+	}
+	if (!generator.Write(outputPath)) {
+		std::cerr << "No se pudo escribir " << outputPath << std::endl;
+		return 1;
+	}
+	std::cout << "Tablas de hasta " << maxPieces << " piezas guardadas en " << outputPath
+		<< " (" << SecondsSince(start) << " s)" << std::endl;
+	return 0;
+}